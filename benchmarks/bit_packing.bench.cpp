@@ -0,0 +1,60 @@
+#include <bitset>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <vector>
+
+namespace {
+constexpr std::size_t mask_bits = 4096;
+constexpr std::size_t map_entries = 100000;
+
+std::bitset<mask_bits> make_mask() {
+	std::bitset<mask_bits> res;
+	for(std::size_t i = 0; i < mask_bits; i += 1 + i % 5) {
+		res.set(i);
+	}
+	return res;
+}
+
+std::vector<bool> make_map() {
+	std::vector<bool> res(map_entries);
+	for(std::size_t i = 0; i < map_entries; i += 1 + i % 3) {
+		res[i] = true;
+	}
+	return res;
+}
+} // namespace
+
+TEST_CASE("packing and unpacking a large std::bitset", "[benchmark]") {
+	const auto mask = make_mask();
+	structocol::vector_buffer<> serialized;
+	structocol::serialize(serialized, mask);
+
+	BENCHMARK("serialize std::bitset<4096>") {
+		structocol::vector_buffer<> buffer;
+		structocol::serialize(buffer, mask);
+		return buffer.available_bytes();
+	};
+	BENCHMARK("deserialize std::bitset<4096>") {
+		auto buffer = serialized;
+		return structocol::deserialize<std::bitset<mask_bits>>(buffer).count();
+	};
+}
+
+TEST_CASE("packing and unpacking a large std::vector<bool>", "[benchmark]") {
+	const auto map = make_map();
+	structocol::vector_buffer<> serialized;
+	structocol::serialize(serialized, map);
+
+	BENCHMARK("serialize std::vector<bool>") {
+		structocol::vector_buffer<> buffer;
+		structocol::serialize(buffer, map);
+		return buffer.available_bytes();
+	};
+	BENCHMARK("deserialize std::vector<bool>") {
+		auto buffer = serialized;
+		return structocol::deserialize<std::vector<bool>>(buffer).size();
+	};
+}
@@ -0,0 +1,97 @@
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <tuple>
+#include <vector>
+
+namespace {
+// Element type with inline storage, for which a move is as expensive as a copy.
+struct price_levels {
+	std::array<std::uint64_t, 16> prices;
+	std::array<std::uint32_t, 16> quantities;
+	std::string venue;
+};
+
+struct level_3 {
+	price_levels levels;
+	std::uint32_t sequence;
+};
+struct level_2 {
+	level_3 inner;
+	std::string tag;
+};
+struct level_1 {
+	level_2 inner;
+	std::tuple<level_3, std::string> extra;
+};
+struct nested_msg {
+	level_1 inner;
+	std::array<level_2, 4> more;
+};
+
+price_levels make_price_levels(std::uint32_t seed) {
+	price_levels res{};
+	for(std::uint32_t i = 0; i < 16; ++i) {
+		res.prices[i] = seed * 1000u + i;
+		res.quantities[i] = seed + i;
+	}
+	res.venue = "XNAS";
+	return res;
+}
+
+template <typename T>
+structocol::vector_buffer<> make_serialized(const T& value, std::size_t copies) {
+	structocol::vector_buffer<> buffer;
+	for(std::size_t i = 0; i < copies; ++i) {
+		structocol::serialize(buffer, value);
+	}
+	return buffer;
+}
+} // namespace
+
+TEST_CASE("deserialization of large arrays", "[benchmark]") {
+	auto levels = std::make_unique<std::array<price_levels, 256>>();
+	for(std::uint32_t i = 0; i < levels->size(); ++i) {
+		(*levels)[i] = make_price_levels(i);
+	}
+	constexpr std::size_t copies = 64;
+	auto serialized = make_serialized(*levels, copies);
+
+	BENCHMARK("std::array<price_levels, 256>") {
+		auto buffer = serialized;
+		std::uint64_t checksum = 0;
+		for(std::size_t i = 0; i < copies; ++i) {
+			auto res = std::make_unique<std::array<price_levels, 256>>(
+					structocol::deserialize<std::array<price_levels, 256>>(buffer));
+			checksum += (*res)[255].prices[15];
+		}
+		return checksum;
+	};
+}
+
+TEST_CASE("deserialization of deeply nested aggregates", "[benchmark]") {
+	nested_msg msg{};
+	msg.inner.inner.inner.levels = make_price_levels(1);
+	std::get<0>(msg.inner.extra).levels = make_price_levels(2);
+	std::get<1>(msg.inner.extra) = "extra";
+	for(std::uint32_t i = 0; i < msg.more.size(); ++i) {
+		msg.more[i].inner.levels = make_price_levels(3 + i);
+	}
+	constexpr std::size_t copies = 1024;
+	auto serialized = make_serialized(msg, copies);
+
+	BENCHMARK("nested_msg") {
+		auto buffer = serialized;
+		std::uint64_t checksum = 0;
+		for(std::size_t i = 0; i < copies; ++i) {
+			auto res = structocol::deserialize<nested_msg>(buffer);
+			checksum += res.more[3].inner.levels.prices[0];
+		}
+		return checksum;
+	};
+}
@@ -0,0 +1,130 @@
+#include <structocol/fd_buffer.hpp>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <string>
+#include <structocol/serialization.hpp>
+#include <structocol/stdio_buffer.hpp>
+#include <structocol/stream_buffer.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <vector>
+
+namespace {
+struct log_entry {
+	std::uint64_t timestamp;
+	std::uint32_t source;
+	std::uint8_t severity;
+	std::string text;
+};
+
+constexpr std::size_t log_entries = 10000;
+
+std::vector<log_entry> make_log() {
+	std::vector<log_entry> res;
+	for(std::size_t i = 0; i < log_entries; ++i) {
+		res.push_back({1'700'000'000'000u + i * 17, std::uint32_t(i % 13), std::uint8_t(i % 5),
+					   "Entry " + std::to_string(i) + " of the message log"});
+	}
+	return res;
+}
+
+template <typename Buffer>
+void write_log(Buffer& buffer, const std::vector<log_entry>& log) {
+	for(const auto& entry : log) {
+		structocol::serialize(buffer, entry);
+	}
+}
+} // namespace
+
+TEST_CASE("writing a message log to a file", "[benchmark]") {
+	const auto log = make_log();
+	const char* file_name = "benchmark_log.temp";
+
+	BENCHMARK("stdio_buffer") {
+		auto fh = std::fopen(file_name, "wb");
+		structocol::stdio_buffer buffer(fh);
+		write_log(buffer, log);
+		return std::fclose(fh);
+	};
+	BENCHMARK("ostream_buffer") {
+		std::ofstream stream(file_name, std::ios::binary | std::ios::trunc);
+		structocol::ostream_buffer buffer(stream);
+		write_log(buffer, log);
+		stream.flush();
+		return stream.good();
+	};
+	BENCHMARK("fd_buffer") {
+		int fd = ::open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		{
+			structocol::fd_buffer buffer(fd);
+			write_log(buffer, log);
+			buffer.flush();
+		}
+		return ::close(fd);
+	};
+	BENCHMARK("fd_buffer gathering per-message buffers") {
+		std::vector<structocol::vector_buffer<>> messages(log.size());
+		std::vector<std::span<const std::byte>> chunks;
+		chunks.reserve(log.size());
+		for(std::size_t i = 0; i < log.size(); ++i) {
+			structocol::serialize(messages[i], log[i]);
+			chunks.push_back(messages[i].available_data());
+		}
+		int fd = ::open(file_name, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		{
+			structocol::fd_buffer buffer(fd);
+			buffer.write_gather(chunks);
+		}
+		return ::close(fd);
+	};
+}
+
+TEST_CASE("reading a message log from a file", "[benchmark]") {
+	const auto log = make_log();
+	const char* file_name = "benchmark_log.temp";
+	{
+		auto fh = std::fopen(file_name, "wb");
+		structocol::stdio_buffer buffer(fh);
+		write_log(buffer, log);
+		std::fclose(fh);
+	}
+
+	BENCHMARK("stdio_buffer") {
+		auto fh = std::fopen(file_name, "rb");
+		structocol::stdio_buffer buffer(fh);
+		std::size_t sum = 0;
+		for(std::size_t i = 0; i < log_entries; ++i) {
+			sum += structocol::deserialize<log_entry>(buffer).text.size();
+		}
+		std::fclose(fh);
+		return sum;
+	};
+	BENCHMARK("istream_buffer") {
+		std::ifstream stream(file_name, std::ios::binary);
+		structocol::istream_buffer buffer(stream);
+		std::size_t sum = 0;
+		for(std::size_t i = 0; i < log_entries; ++i) {
+			sum += structocol::deserialize<log_entry>(buffer).text.size();
+		}
+		return sum;
+	};
+	BENCHMARK("fd_buffer") {
+		int fd = ::open(file_name, O_RDONLY);
+		std::size_t sum = 0;
+		{
+			structocol::fd_buffer buffer(fd);
+			for(std::size_t i = 0; i < log_entries; ++i) {
+				sum += structocol::deserialize<log_entry>(buffer).text.size();
+			}
+		}
+		::close(fd);
+		return sum;
+	};
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <vector>
+
+namespace {
+struct order_msg {
+	std::string symbol;
+	std::string client_id;
+	std::vector<std::uint64_t> fills;
+	std::map<std::string, std::string> tags;
+};
+struct pmr_order_msg {
+	std::pmr::string symbol;
+	std::pmr::string client_id;
+	std::pmr::vector<std::uint64_t> fills;
+	std::pmr::map<std::pmr::string, std::pmr::string> tags;
+};
+
+constexpr std::size_t batch_size = 1024;
+
+structocol::vector_buffer<> make_batch() {
+	structocol::vector_buffer<> buffer;
+	order_msg msg{"instrument symbol long enough to allocate",
+				  "client identifier long enough to allocate",
+				  {1, 2, 3, 4, 5, 6, 7, 8},
+				  {{"first tag key long enough to allocate", "first tag value long enough to allocate"},
+				   {"second tag key long enough to allocate", "second tag value long enough to allocate"}}};
+	for(std::size_t i = 0; i < batch_size; ++i) {
+		structocol::protocol_handler<order_msg>::encode_message(buffer, msg);
+	}
+	return buffer;
+}
+} // namespace
+
+TEST_CASE("decoding a batch of messages using the global allocator or an arena", "[benchmark]") {
+	const auto batch = make_batch();
+
+	BENCHMARK("global allocator") {
+		auto buffer = batch;
+		std::size_t checksum = 0;
+		for(std::size_t i = 0; i < batch_size; ++i) {
+			structocol::protocol_handler<order_msg>::process_message(
+					buffer, [&checksum](const order_msg& msg) { checksum += msg.tags.size(); });
+		}
+		return checksum;
+	};
+
+	std::pmr::monotonic_buffer_resource arena;
+	BENCHMARK("monotonic_buffer_resource released per batch") {
+		auto buffer = batch;
+		std::size_t checksum = 0;
+		for(std::size_t i = 0; i < batch_size; ++i) {
+			structocol::protocol_handler<pmr_order_msg>::process_message(
+					buffer, [&checksum](const pmr_order_msg& msg) { checksum += msg.tags.size(); }, arena);
+		}
+		arena.release();
+		return checksum;
+	};
+}
@@ -0,0 +1,64 @@
+#include <structocol/mmap_buffer.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <structocol/serialization.hpp>
+#include <structocol/stdio_buffer.hpp>
+#include <vector>
+
+namespace {
+constexpr std::size_t archive_messages = 100000;
+constexpr const char* archive_file_name = "benchmark_archive.temp";
+
+void write_archive() {
+	auto fh = std::fopen(archive_file_name, "wb");
+	structocol::stdio_buffer buffer(fh);
+	std::string payload(200, 'x');
+	for(std::size_t i = 0; i < archive_messages; ++i) {
+		structocol::serialize(buffer, std::uint64_t(i));
+		structocol::serialize(buffer, payload);
+	}
+	std::fclose(fh);
+}
+} // namespace
+
+TEST_CASE("replaying a message archive from a file", "[benchmark]") {
+	write_archive();
+
+	BENCHMARK("stdio_buffer with std::string payloads") {
+		auto fh = std::fopen(archive_file_name, "rb");
+		structocol::stdio_buffer buffer(fh);
+		std::size_t sum = 0;
+		for(std::size_t i = 0; i < archive_messages; ++i) {
+			sum += structocol::deserialize<std::uint64_t>(buffer);
+			sum += structocol::deserialize<std::string>(buffer).size();
+		}
+		std::fclose(fh);
+		return sum;
+	};
+	BENCHMARK("mmap_buffer with std::string payloads") {
+		structocol::mmap_buffer buffer{std::string(archive_file_name)};
+		std::size_t sum = 0;
+		for(std::size_t i = 0; i < archive_messages; ++i) {
+			sum += structocol::deserialize<std::uint64_t>(buffer);
+			sum += structocol::deserialize<std::string>(buffer).size();
+		}
+		return sum;
+	};
+	BENCHMARK("mmap_buffer with borrowed std::string_view payloads") {
+		structocol::mmap_buffer buffer{std::string(archive_file_name)};
+		std::size_t sum = 0;
+		for(std::size_t i = 0; i < archive_messages; ++i) {
+			sum += structocol::deserialize<std::uint64_t>(buffer);
+			sum += structocol::deserialize<std::string_view>(buffer).size();
+		}
+		return sum;
+	};
+}
+
+#endif
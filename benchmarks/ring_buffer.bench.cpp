@@ -0,0 +1,50 @@
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <structocol/ring_buffer.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+
+namespace {
+struct backlog_message {
+	std::uint64_t sequence;
+	std::uint32_t channel;
+	std::string payload;
+};
+
+constexpr std::size_t backlog_messages = 10000;
+constexpr std::size_t processed_messages = 10000;
+
+// Keeps a constant backlog of unread messages in the buffer while writing and reading processed_messages messages,
+// then drops the backlog, so that the buffer starts empty (but with its capacity) in the next run.
+template <typename Buffer>
+std::uint64_t process_with_backlog(Buffer& buffer) {
+	backlog_message msg{0, 3, std::string(100, 'x')};
+	for(std::size_t i = 0; i < backlog_messages; ++i) {
+		msg.sequence = i;
+		structocol::serialize(buffer, msg);
+	}
+	std::uint64_t sum = 0;
+	for(std::size_t i = 0; i < processed_messages; ++i) {
+		msg.sequence = backlog_messages + i;
+		structocol::serialize(buffer, msg);
+		sum += structocol::deserialize<backlog_message>(buffer).sequence;
+	}
+	buffer.skip(buffer.available_bytes());
+	return sum;
+}
+} // namespace
+
+TEST_CASE("processing messages with a steady backlog", "[benchmark]") {
+	BENCHMARK_ADVANCED("vector_buffer")(Catch::Benchmark::Chronometer meter) {
+		structocol::vector_buffer<> buffer;
+		process_with_backlog(buffer);
+		meter.measure([&buffer] { return process_with_backlog(buffer); });
+	};
+	BENCHMARK_ADVANCED("ring_buffer")(Catch::Benchmark::Chronometer meter) {
+		structocol::ring_buffer buffer;
+		process_with_backlog(buffer);
+		meter.measure([&buffer] { return process_with_backlog(buffer); });
+	};
+}
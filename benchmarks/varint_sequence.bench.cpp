@@ -0,0 +1,48 @@
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <structocol/serialization.hpp>
+#include <structocol/varint_sequence.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <vector>
+
+namespace {
+constexpr std::size_t sequence_length = 4096;
+constexpr std::size_t copies = 64;
+
+template <typename Seq>
+structocol::vector_buffer<> make_serialized() {
+	Seq seq;
+	for(std::size_t i = 0; i < sequence_length; ++i) {
+		// Mix of small and large values, as for ids and deltas with occasional outliers.
+		seq.push_back(std::uint32_t(i % 16 == 0 ? i * 100003u : i % 200));
+	}
+	structocol::vector_buffer<> buffer;
+	for(std::size_t i = 0; i < copies; ++i) {
+		structocol::serialize(buffer, seq);
+	}
+	return buffer;
+}
+} // namespace
+
+TEST_CASE("decoding integer sequences as varint_t elements or as varint_sequence", "[benchmark]") {
+	const auto varints = make_serialized<std::vector<structocol::varint_t>>();
+	const auto sequences = make_serialized<structocol::varint_sequence<std::uint32_t>>();
+
+	BENCHMARK("std::vector<varint_t>") {
+		auto buffer = varints;
+		std::uint64_t checksum = 0;
+		for(std::size_t i = 0; i < copies; ++i) {
+			checksum += structocol::deserialize<std::vector<structocol::varint_t>>(buffer).back();
+		}
+		return checksum;
+	};
+	BENCHMARK("varint_sequence<std::uint32_t>") {
+		auto buffer = sequences;
+		std::uint64_t checksum = 0;
+		for(std::size_t i = 0; i < copies; ++i) {
+			checksum += structocol::deserialize<structocol::varint_sequence<std::uint32_t>>(buffer).back();
+		}
+		return checksum;
+	};
+}
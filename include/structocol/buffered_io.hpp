@@ -0,0 +1,172 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_BUFFERED_IO_INCLUDED
+#define STRUCTOCOL_BUFFERED_IO_INCLUDED
+
+#include "exceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace structocol {
+
+// Default size of the internal block of the buffered IO adapters, e.g. buffered_stdio_output_buffer.
+constexpr std::size_t default_io_block_size = 0x10000u;
+
+namespace detail {
+
+// Common implementation of the buffered input adapters: Reads from the underlying source in blocks of a configurable
+// size, so that the reads of individual fields are served from memory. Reads that are larger than the block bypass it.
+// Derived provides std::size_t read_block(std::span<std::byte>), which reads up to the given number of bytes and
+// returns how many were read, where 0 indicates the end of the data, and throws io_error if an error occurs.
+// As the source is read ahead, its position is unspecified relative to the consumed data.
+template <typename Derived>
+class block_input_buffer {
+	std::vector<std::byte> block_;
+	std::size_t begin_ = 0;
+	std::size_t end_ = 0;
+
+	Derived& derived() noexcept {
+		return static_cast<Derived&>(*this);
+	}
+
+	// Consumes the buffered bytes into data, refilling the block as needed.
+	bool read_slow(std::span<std::byte> data) {
+		auto buffered = end_ - begin_;
+		std::copy_n(block_.begin() + begin_, buffered, data.begin());
+		data = data.subspan(buffered);
+		begin_ = end_ = 0;
+		while(data.size() >= block_.size()) {
+			auto bytes_read = derived().read_block(data);
+			if(bytes_read == 0) return false;
+			data = data.subspan(bytes_read);
+		}
+		while(!data.empty()) {
+			end_ = derived().read_block(block_);
+			if(end_ == 0) return false;
+			begin_ = std::min(end_, data.size());
+			std::copy_n(block_.begin(), begin_, data.begin());
+			data = data.subspan(begin_);
+		}
+		return true;
+	}
+
+protected:
+	explicit block_input_buffer(std::size_t block_size) : block_(std::max<std::size_t>(block_size, 1)) {}
+	~block_input_buffer() = default;
+
+public:
+	block_input_buffer(const block_input_buffer&) = delete;
+	block_input_buffer& operator=(const block_input_buffer&) = delete;
+
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		std::array<std::byte, bytes> buf;
+		read_into(buf);
+		return buf;
+	}
+
+	// In case of a failure, the bytes that were available are consumed nevertheless.
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() {
+		std::array<std::byte, bytes> buf;
+		if(!try_read_into(buf)) return std::nullopt;
+		return buf;
+	}
+
+	void read_into(std::span<std::byte> data) {
+		if(!try_read_into(data)) throw io_error("Not enough bytes left to read from the underlying source.");
+	}
+
+	bool try_read_into(std::span<std::byte> data) {
+		if(data.size() > end_ - begin_) return read_slow(data);
+		std::copy_n(block_.begin() + begin_, data.size(), data.begin());
+		begin_ += data.size();
+		return true;
+	}
+
+	// Consumes the given number of bytes without reading them.
+	void skip(std::size_t bytes) {
+		if(!try_skip(bytes)) throw io_error("Not enough bytes left to read from the underlying source.");
+	}
+
+	bool try_skip(std::size_t bytes) {
+		while(bytes > end_ - begin_) {
+			bytes -= end_ - begin_;
+			begin_ = 0;
+			end_ = derived().read_block(block_);
+			if(end_ == 0) return false;
+		}
+		begin_ += bytes;
+		return true;
+	}
+
+	// The number of bytes that were read ahead from the source, but not consumed yet.
+	std::size_t buffered_bytes() const noexcept {
+		return end_ - begin_;
+	}
+};
+
+// Common implementation of the buffered output adapters: Collects the written data in a block of a configurable size
+// and passes it to the underlying sink when it is full or flushed. Writes that are larger than the block bypass it.
+// Derived provides void write_block(std::span<const std::byte>), which writes all given bytes or throws io_error, and
+// calls flush_block() in its destructor and in a public flush() member. So the remaining data are written on flush() or
+// on destruction, where errors can't be reported, so flush() should be called explicitly to detect them.
+template <typename Derived>
+class block_output_buffer {
+	std::vector<std::byte> block_;
+	std::size_t end_ = 0;
+
+	Derived& derived() noexcept {
+		return static_cast<Derived&>(*this);
+	}
+
+protected:
+	explicit block_output_buffer(std::size_t block_size) : block_(std::max<std::size_t>(block_size, 1)) {}
+	~block_output_buffer() = default;
+
+	void flush_block() {
+		if(end_ == 0) return;
+		derived().write_block(std::span<const std::byte>(block_.data(), end_));
+		end_ = 0;
+	}
+
+public:
+	block_output_buffer(const block_output_buffer&) = delete;
+	block_output_buffer& operator=(const block_output_buffer&) = delete;
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+		if(data.size() > block_.size() - end_) {
+			flush_block();
+			if(data.size() >= block_.size()) {
+				derived().write_block(data);
+				return;
+			}
+		}
+		std::copy(data.begin(), data.end(), block_.begin() + end_);
+		end_ += data.size();
+	}
+
+	// The number of written bytes that were not passed to the sink yet.
+	std::size_t buffered_bytes() const noexcept {
+		return end_;
+	}
+};
+
+} // namespace detail
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_BUFFERED_IO_INCLUDED
@@ -0,0 +1,56 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_ERROR_CODE_INCLUDED
+#define STRUCTOCOL_ERROR_CODE_INCLUDED
+
+#include <string>
+#include <system_error>
+
+namespace structocol {
+
+// Error conditions reported by the non-throwing deserialization functions (try_deserialize, etc.).
+enum class errc {
+	// The buffer didn't contain enough data, corresponds to buffer_length_error.
+	insufficient_data = 1,
+	// The data don't represent a valid value, corresponds to deserialization_data_error.
+	invalid_data,
+	// The data exceed the decode_limits given for the deserialization, corresponds to decode_limit_error.
+	limit_exceeded,
+};
+
+namespace detail {
+class error_category_impl : public std::error_category {
+public:
+	const char* name() const noexcept override {
+		return "structocol";
+	}
+	std::string message(int ev) const override {
+		switch(static_cast<errc>(ev)) {
+		case errc::insufficient_data: return "Not enough data available for deserialization.";
+		case errc::invalid_data: return "Invalid data encountered during deserialization.";
+		case errc::limit_exceeded: return "Deserialized data exceed the decode limits.";
+		default: return "Unknown structocol error.";
+		}
+	}
+};
+} // namespace detail
+
+inline const std::error_category& error_category() noexcept {
+	static const detail::error_category_impl category;
+	return category;
+}
+
+inline std::error_code make_error_code(errc e) noexcept {
+	return std::error_code(static_cast<int>(e), error_category());
+}
+
+} // namespace structocol
+
+template <>
+struct std::is_error_code_enum<structocol::errc> : std::true_type {};
+
+#endif // STRUCTOCOL_ERROR_CODE_INCLUDED
@@ -37,6 +37,10 @@ class deserialization_data_error : public runtime_error {
 	using runtime_error::runtime_error;
 };
 
+class decode_limit_error : public deserialization_data_error {
+	using deserialization_data_error::deserialization_data_error;
+};
+
 } // namespace structocol
 
 #endif // STRUCTOCOL_EXCEPTIONS_INCLUDED
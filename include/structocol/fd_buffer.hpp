@@ -0,0 +1,141 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_FD_BUFFER_INCLUDED
+#define STRUCTOCOL_FD_BUFFER_INCLUDED
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+
+#include "exceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <climits>
+#include <cstddef>
+#include <span>
+#include <structocol/buffered_io.hpp>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <vector>
+
+namespace structocol {
+
+// Buffer operating directly on a POSIX file descriptor in blocking mode, e.g. of a file, a pipe or a Unix socket.
+// Reading is done by large read() calls into an internal block (see detail::block_input_buffer), writing collects small
+// writes in a second block and passes larger ones, together with the collected data, to the descriptor using writev().
+// The remaining data are written as described for detail::block_output_buffer. The descriptor is not owned by the
+// buffer.
+// As the descriptor is read ahead, interleaving reads and writes on the same file is not supported.
+class fd_buffer : public detail::block_input_buffer<fd_buffer> {
+	friend class detail::block_input_buffer<fd_buffer>;
+	int fd_;
+	std::vector<std::byte> write_block_;
+	std::size_t write_end_ = 0;
+	std::vector<iovec> iovecs_;
+
+	std::size_t read_block(std::span<std::byte> data) {
+		for(;;) {
+			auto bytes_read = ::read(fd_, data.data(), data.size());
+			if(bytes_read >= 0) return std::size_t(bytes_read);
+			if(errno != EINTR) throw io_error("IO error while reading from the file descriptor.");
+		}
+	}
+
+	void add_iovec(std::span<const std::byte> data) {
+		if(data.empty()) return;
+		// writev() takes the data as non-const, but doesn't modify them.
+		iovecs_.push_back(iovec{const_cast<std::byte*>(data.data()), data.size()});
+	}
+
+	// Writes all data described by iovecs_, continuing after partial writes. The collected data, which are described by
+	// the first iovec, are only dropped from the write block as far as they were written, so that they remain pending
+	// if writing fails.
+	void write_iovecs() {
+		auto iov = std::span<iovec>(iovecs_);
+		std::size_t total_written = 0;
+		while(!iov.empty()) {
+			auto count = std::min<std::size_t>(iov.size(), IOV_MAX);
+			auto bytes_written = ::writev(fd_, iov.data(), int(count));
+			if(bytes_written < 0) {
+				if(errno == EINTR) continue;
+				iovecs_.clear();
+				auto collected_written = std::min(total_written, write_end_);
+				std::copy(write_block_.begin() + collected_written, write_block_.begin() + write_end_,
+						  write_block_.begin());
+				write_end_ -= collected_written;
+				throw io_error("IO error while writing to the file descriptor.");
+			}
+			total_written += std::size_t(bytes_written);
+			auto remaining = std::size_t(bytes_written);
+			while(!iov.empty() && remaining >= iov.front().iov_len) {
+				remaining -= iov.front().iov_len;
+				iov = iov.subspan(1);
+			}
+			if(remaining > 0) {
+				iov.front().iov_base = static_cast<std::byte*>(iov.front().iov_base) + remaining;
+				iov.front().iov_len -= remaining;
+			}
+		}
+		iovecs_.clear();
+		write_end_ = 0;
+	}
+
+public:
+	explicit fd_buffer(int fd, std::size_t block_size = default_io_block_size)
+			: block_input_buffer(block_size), fd_{fd}, write_block_(std::max<std::size_t>(block_size, 1)) {}
+	~fd_buffer() {
+		try {
+			flush();
+		} catch(...) {
+		}
+	}
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+		if(data.size() <= write_block_.size() - write_end_) {
+			std::copy(data.begin(), data.end(), write_block_.begin() + write_end_);
+			write_end_ += data.size();
+			return;
+		}
+		write_gather(std::span(&data, 1));
+	}
+
+	// Writes the collected data, followed by the given chunks, e.g. the encoded messages of a queue of buffers, with as
+	// few writev() calls as possible.
+	void write_gather(std::span<const std::span<const std::byte>> chunks) {
+		iovecs_.clear();
+		iovecs_.reserve(chunks.size() + 1);
+		add_iovec(std::span<const std::byte>(write_block_.data(), write_end_));
+		for(auto chunk : chunks) {
+			add_iovec(chunk);
+		}
+		write_iovecs();
+	}
+
+	// Writes the collected data to the file descriptor.
+	void flush() {
+		write_gather({});
+	}
+
+	// The number of written bytes that were not passed to the file descriptor yet.
+	std::size_t pending_bytes() const noexcept {
+		return write_end_;
+	}
+
+	int fd() const noexcept {
+		return fd_;
+	}
+};
+
+} // namespace structocol
+
+#endif // __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+
+#endif // STRUCTOCOL_FD_BUFFER_INCLUDED
@@ -0,0 +1,133 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_INCREMENTAL_DECODER_INCLUDED
+#define STRUCTOCOL_INCREMENTAL_DECODER_INCLUDED
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/scanning.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace structocol {
+
+namespace detail {
+
+template <typename Scanned_Type>
+class incremental_decoder_base {
+	serialized_size_scanner<Scanned_Type> scanner_;
+	bool scanning_ = false;
+
+protected:
+	vector_buffer<> buffer_;
+
+	// Checks if the next value is completely available in buffer_, continuing the scan where the previous call left
+	// off. When this returns true, the value can be deserialized from buffer_ and the next call will start scanning
+	// the following value.
+	bool next_complete() {
+		if(!scanning_) {
+			if(buffer_.available_bytes() == 0) {
+				buffer_.clear();
+				return false;
+			}
+			scanner_.reset();
+			scanning_ = true;
+		}
+		if(!scanner_.resume(buffer_.available_data())) return false;
+		scanning_ = false;
+		return true;
+	}
+
+public:
+	// Appends received data to the internal buffer.
+	void feed(std::span<const std::byte> data) {
+		buffer_.write(data);
+	}
+	template <std::size_t bytes>
+	void feed(const std::array<std::byte, bytes>& data) {
+		buffer_.write(data);
+	}
+
+	// Number of received bytes that weren't consumed by a decoded value yet.
+	std::size_t buffered_bytes() const noexcept {
+		return buffer_.available_bytes();
+	}
+
+	// Discards all buffered data and the scan state.
+	// Must be used to resynchronize after an exception was thrown because of invalid data.
+	void reset() noexcept {
+		buffer_.clear();
+		scanner_.reset();
+		scanning_ = false;
+	}
+};
+
+template <typename T>
+struct is_protocol_handler : std::false_type {};
+template <typename Policy, typename... Msgs>
+struct is_protocol_handler<basic_protocol_handler<Policy, Msgs...>> : std::true_type {};
+
+} // namespace detail
+
+// Decodes a stream of serialized T values that arrives in arbitrarily split chunks.
+// The chunks are passed to feed() and next() returns the decoded values as soon as they are completely available.
+// Between calls, the decoder keeps track of how far it has already examined the buffered data, so that each byte is
+// looked at only once for finding the end of a value and once for deserializing it, regardless of the number of
+// chunks it arrives in.
+// T must only (recursively) contain types that use the built-in serializers, as its structure needs to be known to
+// find the end of a value.
+template <typename T>
+class incremental_decoder : public detail::incremental_decoder_base<T> {
+	static_assert(!detail::is_protocol_handler<T>::value,
+				  "Protocol handlers are decoded by the corresponding specialization of incremental_decoder.");
+
+public:
+	// Returns the next value if it is completely available, or std::nullopt if more data need to be fed first.
+	// Throws deserialization_data_error if invalid data were encountered.
+	std::optional<T> next() {
+		if(!this->next_complete()) return std::nullopt;
+		return deserialize<T>(this->buffer_);
+	}
+};
+
+// Specialization for decoding a stream of messages encoded by protocol_handler<Msgs...>::encode_message.
+// As the scanning only supports the default format, other formats of basic_protocol_handler are rejected.
+template <typename Policy, typename... Msgs>
+class incremental_decoder<basic_protocol_handler<Policy, Msgs...>>
+		: public detail::incremental_decoder_base<typename basic_protocol_handler<Policy, Msgs...>::any_message_t> {
+	static_assert(std::is_same_v<Policy, big_endian_format>,
+				  "incremental_decoder only supports protocol handlers using the default format big_endian_format.");
+	using handler_type = basic_protocol_handler<Policy, Msgs...>;
+	// The scan relies on the message encoding being the same as for the corresponding variant.
+	static_assert(std::is_same_v<typename handler_type::type_index_t, sufficient_uint_t<sizeof...(Msgs)>>);
+
+public:
+	// Returns the next message if it is completely available, or std::nullopt if more data need to be fed first.
+	std::optional<typename handler_type::any_message_t> next() {
+		if(!this->next_complete()) return std::nullopt;
+		return handler_type::decode_message(this->buffer_);
+	}
+
+	// Invokes handler with the next message if it is completely available and returns true in this case, otherwise
+	// returns false.
+	template <typename HandlerFunc>
+	bool process_next(HandlerFunc&& handler) {
+		if(!this->next_complete()) return false;
+		handler_type::process_message(this->buffer_, std::forward<HandlerFunc>(handler));
+		return true;
+	}
+};
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_INCREMENTAL_DECODER_INCLUDED
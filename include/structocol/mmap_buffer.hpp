@@ -0,0 +1,118 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_MMAP_BUFFER_INCLUDED
+#define STRUCTOCOL_MMAP_BUFFER_INCLUDED
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#include "exceptions.hpp"
+#include <cstddef>
+#include <fcntl.h>
+#include <span>
+#include <string>
+#include <structocol/span_buffer.hpp>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+namespace structocol {
+
+// Read-only buffer over a file that is mapped into memory, so that reading doesn't copy the data through stdio and
+// borrowed views (see read_view) refer directly to the page cache. The mapping is advised to be read sequentially.
+// Reading is done by the span_read_buffer over the unread part of the mapping. Views remain valid as long as the
+// buffer exists.
+class mmap_buffer : public span_read_buffer {
+	const std::byte* data_ = nullptr;
+	std::size_t size_ = 0;
+
+	std::span<const std::byte> mapping() const noexcept {
+		return std::span<const std::byte>(data_, size_);
+	}
+
+	void map(int fd) {
+		struct stat file_stat;
+		if(::fstat(fd, &file_stat) != 0) throw io_error("Couldn't determine the size of the file to map.");
+		size_ = std::size_t(file_stat.st_size);
+		if(size_ == 0) return;
+		void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(addr == MAP_FAILED) {
+			size_ = 0;
+			throw io_error("Couldn't map the file into memory.");
+		}
+		data_ = static_cast<const std::byte*>(addr);
+		span_read_buffer::operator=(span_read_buffer(mapping()));
+		// The hints are only an optimization, so their failure is ignored.
+#ifdef MADV_SEQUENTIAL
+		::madvise(addr, size_, MADV_SEQUENTIAL);
+#endif
+#ifdef MADV_WILLNEED
+		::madvise(addr, size_, MADV_WILLNEED);
+#endif
+	}
+
+	void unmap() noexcept {
+		if(data_) ::munmap(const_cast<std::byte*>(data_), size_);
+		data_ = nullptr;
+		size_ = 0;
+		span_read_buffer::operator=(span_read_buffer({}));
+	}
+
+public:
+	// Maps the whole file referred to by the given descriptor, which remains owned by the caller and can be closed
+	// afterwards.
+	explicit mmap_buffer(int fd) : span_read_buffer({}) {
+		map(fd);
+	}
+
+	explicit mmap_buffer(const std::string& path) : span_read_buffer({}) {
+		int fd = ::open(path.c_str(), O_RDONLY);
+		if(fd < 0) throw io_error("Couldn't open the file to map.");
+		try {
+			map(fd);
+		} catch(...) {
+			::close(fd);
+			throw;
+		}
+		::close(fd);
+	}
+
+	mmap_buffer(mmap_buffer&& other) noexcept
+			: span_read_buffer(std::exchange<span_read_buffer>(other, span_read_buffer({}))),
+			  data_{std::exchange(other.data_, nullptr)}, size_{std::exchange(other.size_, 0)} {}
+
+	mmap_buffer& operator=(mmap_buffer&& other) noexcept {
+		if(this != &other) {
+			unmap();
+			span_read_buffer::operator=(std::exchange<span_read_buffer>(other, span_read_buffer({})));
+			data_ = std::exchange(other.data_, nullptr);
+			size_ = std::exchange(other.size_, 0);
+		}
+		return *this;
+	}
+
+	~mmap_buffer() {
+		unmap();
+	}
+
+	// The size of the whole mapped file.
+	std::size_t size() const noexcept {
+		return size_;
+	}
+
+	// Continues reading at the given offset from the beginning of the file, e.g. to replay it again.
+	void seek(std::size_t offset) {
+		if(offset > size_) throw buffer_length_error("Offset is beyond the end of the mapped file.");
+		span_read_buffer::operator=(span_read_buffer(mapping().subspan(offset)));
+	}
+};
+
+} // namespace structocol
+
+#endif // __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#endif // STRUCTOCOL_MMAP_BUFFER_INCLUDED
@@ -84,8 +84,9 @@ void encode_message_multiplexed(Buffer& buffer, const MessageType& msg) {
 	if(len > std::numeric_limits<LengthFieldType>::max()) {
 		throw message_length_overflow("Message too long for given length type.");
 	}
+	structocol::reserve_for_write(buffer, structocol::serialized_size<LengthFieldType>() + len);
 	structocol::serialize(buffer, static_cast<LengthFieldType>(len));
-	ProtocolHandler::encode_message(buffer, msg);
+	ProtocolHandler::encode_message(buffer, msg, len);
 }
 
 } // namespace structocol
@@ -8,20 +8,36 @@
 #define STRUCTOCOL_PROTOCOL_HANDLER_INCLUDED
 
 #include "exceptions.hpp"
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <memory_resource>
+#include <optional>
 #include <structocol/serialization.hpp>
 #include <structocol/type_utilities.hpp>
+#include <system_error>
+#include <utility>
 #include <variant>
 
 namespace structocol {
 
-template <typename... Msgs>
-class protocol_handler {
+// Encodes and decodes messages of the given types in the given wire format, see big_endian_format.
+template <typename Policy, typename... Msgs>
+class basic_protocol_handler {
+	static_assert(is_format_policy_v<Policy>, "The first template argument must be a wire format policy.");
+
+	// The handler (de)serializes through a buffer adapter applying its format, unless the buffer already uses it.
+	template <typename Buff>
+	static constexpr bool uses_format_v = std::is_same_v<detail::buffer_format_t<Buff>, Policy>;
+
 	template <typename Buff, typename HandlerFunc>
 	using process_impl_ptr = void (*)(Buff&, HandlerFunc&&);
 	template <typename Buff, typename HandlerFunc, typename Msg>
 	static process_impl_ptr<Buff, HandlerFunc> make_process_impl() {
-		return [](Buff& buffer, HandlerFunc&& handler) { handler(deserialize<Msg>(buffer)); };
+		return [](Buff& buffer, HandlerFunc&& handler) {
+			auto msg = deserialize<Msg>(buffer);
+			if(!detail::deserialization_failed(buffer)) handler(std::move(msg));
+		};
 	}
 
 	template <typename Buff>
@@ -33,43 +49,201 @@ class protocol_handler {
 		};
 	}
 
+	template <typename Buff, typename Msg>
+	static void encode_message_impl(Buff& buffer, const Msg& msg) {
+		if constexpr(!uses_format_v<Buff>) {
+			detail::format_buffer<Policy, Buff> format_buffer(buffer);
+			encode_message_impl(format_buffer, msg);
+		} else {
+			constexpr auto type_index = index_of_type_v<Msg, Msgs...>;
+			serialize(buffer, type_index_t{type_index});
+			serialize(buffer, msg);
+		}
+	}
+
+	template <typename Buff>
+	static std::size_t traverse_message(Buff& buffer,
+										const std::array<void (*)(Buff&), sizeof...(Msgs)>& impl_table) {
+		static_assert(uses_format_v<Buff>);
+		auto type_index = deserialize<type_index_t>(buffer);
+		if(type_index >= sizeof...(Msgs)) {
+			detail::report_data_error(buffer, "Invalid message type.");
+			return type_index;
+		}
+		impl_table[type_index](buffer);
+		return type_index;
+	}
+
 public:
 	using type_index_t = sufficient_uint_t<sizeof...(Msgs)>;
 	using any_message_t = std::variant<Msgs...>;
 	template <typename Buff, typename Msg>
 	static void encode_message(Buff& buffer, const Msg& msg) {
-		constexpr auto type_index = index_of_type_v<Msg, Msgs...>;
-		serialize(buffer, type_index_t{type_index});
-		serialize(buffer, msg);
+		if constexpr(supports_write_reservation_v<Buff>) {
+			reserve_for_write(buffer, calculate_message_size(msg));
+		}
+		encode_message_impl(buffer, msg);
+	}
+
+	// Same as above, but with the result of calculate_message_size(msg) already known by the caller.
+	template <typename Buff, typename Msg>
+	static void encode_message(Buff& buffer, const Msg& msg, std::size_t message_size) {
+		reserve_for_write(buffer, message_size);
+		encode_message_impl(buffer, msg);
 	}
 
 	template <typename Msg>
 	static std::size_t calculate_message_size(const Msg& msg) {
 		constexpr auto type_index = index_of_type_v<Msg, Msgs...>;
-		return serialized_size(type_index_t{type_index}) + serialized_size(msg);
+		return serialized_size<Policy>(type_index_t{type_index}) + serialized_size<Policy>(msg);
 	}
 
 	template <typename Buff>
 	static any_message_t decode_message(Buff& buffer) {
-		decode_impl_ptr<Buff> impl_table[] = {make_decode_impl<Buff, Msgs>()...};
-		auto type_index = deserialize<type_index_t>(buffer);
-		if(type_index >= sizeof...(Msgs)) {
-			throw deserialization_data_error("Invalid message type.");
+		if constexpr(!uses_format_v<Buff>) {
+			detail::format_buffer<Policy, Buff> format_buffer(buffer);
+			return decode_message(format_buffer);
+		} else {
+			decode_impl_ptr<Buff> impl_table[] = {make_decode_impl<Buff, Msgs>()...};
+			auto type_index = deserialize<type_index_t>(buffer);
+			if(type_index >= sizeof...(Msgs)) {
+				detail::report_data_error(buffer, "Invalid message type.");
+				type_index = 0;
+			}
+			return impl_table[type_index](buffer);
 		}
-		return impl_table[type_index](buffer);
+	}
+
+	// Variant of decode_message that enforces the given decode limits, see decode_limits.
+	template <typename Buff>
+	static any_message_t decode_message(Buff& buffer, const decode_limits& limits) {
+		detail::limited_buffer<Buff> limited(buffer, limits);
+		return decode_message(limited);
+	}
+
+	// Variant of decode_message that allocates the containers in the message from the given memory resource, see
+	// deserialize.
+	template <typename Buff>
+	static any_message_t decode_message(Buff& buffer, std::pmr::memory_resource& resource) {
+		detail::memory_resource_buffer<Buff> resource_buffer(buffer, resource);
+		return decode_message(resource_buffer);
+	}
+
+	// Non-throwing variant of decode_message, see try_deserialize.
+	template <typename Buff>
+	static std::optional<any_message_t> try_decode_message(Buff& buffer, std::error_code& ec) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		auto msg = decode_message(ec_buffer);
+		if(ec) return std::nullopt;
+		return msg;
+	}
+	template <typename Buff>
+	static std::optional<any_message_t> try_decode_message(Buff& buffer, std::error_code& ec,
+														   const decode_limits& limits) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		auto msg = decode_message(ec_buffer, limits);
+		if(ec) return std::nullopt;
+		return msg;
+	}
+	template <typename Buff>
+	static std::optional<any_message_t> try_decode_message(Buff& buffer, std::error_code& ec,
+														   std::pmr::memory_resource& resource) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		auto msg = decode_message(ec_buffer, resource);
+		if(ec) return std::nullopt;
+		return msg;
 	}
 
 	template <typename Buff, typename HandlerFunc>
 	static void process_message(Buff& buffer, HandlerFunc&& handler) {
-		process_impl_ptr<Buff, HandlerFunc> impl_table[] = {make_process_impl<Buff, HandlerFunc, Msgs>()...};
-		auto type_index = deserialize<type_index_t>(buffer);
-		if(type_index >= sizeof...(Msgs)) {
-			throw deserialization_data_error("Invalid message type.");
+		if constexpr(!uses_format_v<Buff>) {
+			detail::format_buffer<Policy, Buff> format_buffer(buffer);
+			process_message(format_buffer, std::forward<HandlerFunc>(handler));
+		} else {
+			process_impl_ptr<Buff, HandlerFunc> impl_table[] = {make_process_impl<Buff, HandlerFunc, Msgs>()...};
+			auto type_index = deserialize<type_index_t>(buffer);
+			if(type_index >= sizeof...(Msgs)) {
+				detail::report_data_error(buffer, "Invalid message type.");
+				return;
+			}
+			impl_table[type_index](buffer, std::forward<HandlerFunc>(handler));
+		}
+	}
+
+	// Variant of process_message that enforces the given decode limits, see decode_limits.
+	template <typename Buff, typename HandlerFunc>
+	static void process_message(Buff& buffer, HandlerFunc&& handler, const decode_limits& limits) {
+		detail::limited_buffer<Buff> limited(buffer, limits);
+		process_message(limited, std::forward<HandlerFunc>(handler));
+	}
+
+	// Variant of process_message that allocates the containers in the message from the given memory resource, see
+	// deserialize.
+	template <typename Buff, typename HandlerFunc>
+	static void process_message(Buff& buffer, HandlerFunc&& handler, std::pmr::memory_resource& resource) {
+		detail::memory_resource_buffer<Buff> resource_buffer(buffer, resource);
+		process_message(resource_buffer, std::forward<HandlerFunc>(handler));
+	}
+
+	// Advances the buffer past the next message without decoding it (see skip) and returns its type index, e.g. for
+	// filtering or relaying messages based on their type.
+	template <typename Buff>
+	static std::size_t skip_message(Buff& buffer) {
+		if constexpr(!uses_format_v<Buff>) {
+			detail::format_buffer<Policy, Buff> format_buffer(buffer);
+			return skip_message(format_buffer);
+		} else {
+			constexpr std::array<void (*)(Buff&), sizeof...(Msgs)> impl_table = {&skip<Msgs, Buff>...};
+			return traverse_message(buffer, impl_table);
+		}
+	}
+
+	// Like skip_message, but checks that the message could be decoded (see validate).
+	template <typename Buff>
+	static std::size_t validate_message(Buff& buffer) {
+		if constexpr(!uses_format_v<Buff>) {
+			detail::format_buffer<Policy, Buff> format_buffer(buffer);
+			return validate_message(format_buffer);
+		} else {
+			constexpr std::array<void (*)(Buff&), sizeof...(Msgs)> impl_table = {&validate<Msgs, Buff>...};
+			return traverse_message(buffer, impl_table);
 		}
-		impl_table[type_index](buffer, std::forward<HandlerFunc>(handler));
+	}
+
+	// Non-throwing variant of process_message, see try_deserialize.
+	// Returns true if the handler was invoked, or false if an error occurred, which is then stored in ec.
+	template <typename Buff, typename HandlerFunc>
+	static bool try_process_message(Buff& buffer, HandlerFunc&& handler, std::error_code& ec) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		process_message(ec_buffer, std::forward<HandlerFunc>(handler));
+		return !ec;
+	}
+	template <typename Buff, typename HandlerFunc>
+	static bool try_process_message(Buff& buffer, HandlerFunc&& handler, std::error_code& ec,
+									const decode_limits& limits) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		process_message(ec_buffer, std::forward<HandlerFunc>(handler), limits);
+		return !ec;
+	}
+	template <typename Buff, typename HandlerFunc>
+	static bool try_process_message(Buff& buffer, HandlerFunc&& handler, std::error_code& ec,
+									std::pmr::memory_resource& resource) {
+		ec.clear();
+		detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+		process_message(ec_buffer, std::forward<HandlerFunc>(handler), resource);
+		return !ec;
 	}
 };
 
+// Protocol handler using the default wire format big_endian_format.
+template <typename... Msgs>
+using protocol_handler = basic_protocol_handler<big_endian_format, Msgs...>;
+
 } // namespace structocol
 
 #endif // STRUCTOCOL_PROTOCOL_HANDLER_INCLUDED
@@ -0,0 +1,226 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_RING_BUFFER_INCLUDED
+#define STRUCTOCOL_RING_BUFFER_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "exceptions.hpp"
+#include <structocol/span_buffer.hpp>
+
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 26812)
+#endif
+#include <boost/asio/buffer.hpp>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif
+
+namespace structocol {
+
+class ring_buffer_dynamic_view;
+
+// Buffer with the same read and write interface as vector_buffer (except for read_view, as the data are not
+// necessarily contiguous), that stores the data in a circular byte array. Reading and writing never move the
+// existing data, so there is no trimming, the data are only moved when the storage needs to grow.
+class ring_buffer : public detail::buffer_read_members<ring_buffer> {
+	std::vector<std::byte> storage_;
+	std::size_t read_offset_ = 0;
+	std::size_t size_ = 0;
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+	std::size_t prepared_ = 0;
+#endif
+
+	std::size_t wrap(std::size_t offset) const noexcept {
+		return offset >= storage_.size() ? offset - storage_.size() : offset;
+	}
+
+	// Splits the region of the given size starting at the given offset into the part before and after the wrap-around.
+	template <typename Byte>
+	static std::array<std::span<Byte>, 2> segments(std::span<Byte> storage, std::size_t offset, std::size_t bytes) {
+		auto first = std::min(bytes, storage.size() - offset);
+		return {storage.subspan(offset, first), storage.first(bytes - first)};
+	}
+
+	void grow(std::size_t min_capacity) {
+		std::vector<std::byte> new_storage(std::max(min_capacity, storage_.size() * 2));
+		auto out = new_storage.begin();
+		for(auto segment : available_segments()) {
+			out = std::copy(segment.begin(), segment.end(), out);
+		}
+		storage_.swap(new_storage);
+		read_offset_ = 0;
+	}
+
+	// The region of the given size following the readable data, which must fit into the writable capacity.
+	std::array<std::span<std::byte>, 2> free_segments(std::size_t bytes) noexcept {
+		return segments(std::span<std::byte>(storage_), wrap(read_offset_ + size_), bytes);
+	}
+
+	void consume(std::size_t bytes) noexcept {
+		size_ -= bytes;
+		read_offset_ = wrap(read_offset_ + bytes);
+		// Restarting at the beginning of the storage when it becomes empty keeps later data contiguous for longer.
+		// Not possible while a prepare()d region, that is committed following the readable data, is outstanding.
+		if(size_ == 0 && !has_prepared_region()) read_offset_ = 0;
+	}
+
+	bool has_prepared_region() const noexcept {
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+		return prepared_ > 0;
+#else
+		return false;
+#endif
+	}
+
+public:
+	ring_buffer() = default;
+	explicit ring_buffer(std::size_t capacity) : storage_(capacity) {}
+
+	bool try_read_into(std::span<std::byte> data) noexcept {
+		if(data.size() > available_bytes()) return false;
+		auto out = data.begin();
+		for(auto segment : segments(std::span<const std::byte>(storage_), read_offset_, data.size())) {
+			out = std::copy(segment.begin(), segment.end(), out);
+		}
+		consume(data.size());
+		return true;
+	}
+
+	bool try_skip(std::size_t bytes) noexcept {
+		if(bytes > available_bytes()) return false;
+		consume(bytes);
+		return true;
+	}
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+		assert(prepared_ == 0 && "write MUST NOT be called when there are prepare()d but not commit()ed writes.");
+#endif
+		if(data.size() > writable_capacity()) grow(size_ + data.size());
+		auto in = data.begin();
+		for(auto segment : free_segments(data.size())) {
+			std::copy_n(in, segment.size(), segment.begin());
+			in += segment.size();
+		}
+		size_ += data.size();
+	}
+
+	std::size_t total_capacity() const noexcept {
+		return storage_.size();
+	}
+
+	std::size_t writable_capacity() const noexcept {
+		return storage_.size() - size_;
+	}
+
+	void reserve(std::size_t writable_capacity) {
+		if(writable_capacity > this->writable_capacity()) grow(size_ + writable_capacity);
+	}
+
+	// The bytes available for reading, as up to two contiguous memory regions (the second one being empty if the data
+	// don't wrap around the end of the storage).
+	// Invalidated by all non-const operations on the buffer.
+	std::array<std::span<const std::byte>, 2> available_segments() const noexcept {
+		return segments(std::span<const std::byte>(storage_), read_offset_, size_);
+	}
+
+	std::size_t available_bytes() const noexcept {
+		return size_;
+	}
+
+	void clear() noexcept {
+		read_offset_ = 0;
+		size_ = 0;
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+		prepared_ = 0;
+#endif
+	}
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+	friend class ring_buffer_dynamic_view;
+	ring_buffer_dynamic_view dynamic_view();
+	ring_buffer_dynamic_view dynamic_view(std::size_t max_size);
+#endif
+};
+
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+// DynamicBuffer adapter for ring_buffer, whose input and output sequences consist of up to two buffers each.
+class ring_buffer_dynamic_view {
+	ring_buffer& rb_;
+	std::size_t max_size_;
+
+	template <typename Buffer, typename Byte>
+	static std::array<Buffer, 2> to_asio(const std::array<std::span<Byte>, 2>& segments) {
+		return {Buffer(segments[0].data(), segments[0].size()), Buffer(segments[1].data(), segments[1].size())};
+	}
+
+public:
+	explicit ring_buffer_dynamic_view(ring_buffer& rb) : rb_{rb}, max_size_{rb.storage_.max_size()} {}
+	explicit ring_buffer_dynamic_view(ring_buffer& rb, std::size_t max_size) : rb_{rb}, max_size_{max_size} {}
+	using const_buffers_type = std::array<boost::asio::const_buffer, 2>;
+	using mutable_buffers_type = std::array<boost::asio::mutable_buffer, 2>;
+
+	std::size_t size() const {
+		return rb_.available_bytes();
+	}
+
+	std::size_t max_size() const {
+		return max_size_;
+	}
+
+	std::size_t capacity() const {
+		return rb_.total_capacity();
+	}
+
+	const_buffers_type data() const {
+		return to_asio<boost::asio::const_buffer>(rb_.available_segments());
+	}
+
+	void consume(std::size_t n) {
+		rb_.consume(std::min(n, rb_.size_));
+	}
+
+	mutable_buffers_type prepare(std::size_t n) {
+		if(rb_.available_bytes() > max_size_ /*input seq already larger*/ ||
+		   max_size_ - rb_.available_bytes() < n /*too little allowed size left for output seq*/) {
+			throw buffer_length_error("Requested output sequence too large for max_size.");
+		}
+		if(n > rb_.writable_capacity()) rb_.grow(rb_.size_ + n);
+		rb_.prepared_ = n;
+		return to_asio<boost::asio::mutable_buffer>(rb_.free_segments(n));
+	}
+
+	void commit(std::size_t n) {
+		rb_.size_ += std::min(n, rb_.prepared_);
+		rb_.prepared_ = 0;
+	}
+};
+
+inline ring_buffer_dynamic_view ring_buffer::dynamic_view() {
+	return ring_buffer_dynamic_view(*this, storage_.max_size());
+}
+inline ring_buffer_dynamic_view ring_buffer::dynamic_view(std::size_t max_size) {
+	return ring_buffer_dynamic_view(*this, max_size);
+}
+#endif
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_RING_BUFFER_INCLUDED
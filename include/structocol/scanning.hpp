@@ -0,0 +1,372 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_SCANNING_INCLUDED
+#define STRUCTOCOL_SCANNING_INCLUDED
+
+#include "exceptions.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <structocol/serialization.hpp>
+#include <structocol/type_utilities.hpp>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace structocol {
+
+namespace detail {
+
+// The scanner determines how many bytes the serialized representation of a value occupies, without deserializing
+// it. It walks the type tree using an explicit stack of frames instead of recursion, so that the scan can be
+// suspended when the available data are exhausted and resumed at the same position in the type tree when more data
+// have arrived.
+
+enum class scan_result { complete, descend, need_more };
+
+struct scan_state;
+using scan_step_fn = scan_result (*)(scan_state&, std::size_t frame_index);
+
+struct scan_frame {
+	scan_step_fn step;
+	// Meaning of the following depends on the scanner of the frame.
+	std::size_t phase = 0;
+	std::size_t count = 0;
+	std::size_t value = 0;
+};
+
+struct scan_state {
+	std::vector<scan_frame> frames;
+	std::span<const std::byte> data;
+	std::size_t offset = 0;
+
+	std::size_t remaining() const noexcept {
+		return data.size() - offset;
+	}
+	std::uint8_t next_byte() noexcept {
+		return std::to_integer<std::uint8_t>(data[offset++]);
+	}
+};
+
+template <typename T, typename Enable = void>
+struct scanner;
+
+template <typename T>
+void push_scan_frame(scan_state& state) {
+	state.frames.push_back(scanner<std::remove_cv_t<T>>::make_frame());
+}
+
+inline std::size_t checked_fixed_size_total(std::size_t count, std::size_t elem_size) {
+	if(elem_size != 0 && count > std::numeric_limits<std::size_t>::max() / elem_size) {
+		throw deserialization_data_error("Container length in serialized data exceeds the addressable size.");
+	}
+	return count * elem_size;
+}
+
+// Resumably reads a varint_t into frame.value, using frame.count for the number of bytes read so far.
+inline bool scan_varint(scan_state& state, scan_frame& frame) {
+	while(state.remaining() > 0) {
+		auto vbval = state.next_byte();
+		if(((frame.value << 7) >> 7) != frame.value) {
+			throw deserialization_data_error("Could not deserialize structocol::varint_t value because it is too large "
+											 "for std::size_t on this platform.");
+		}
+		frame.value = (frame.value << 7) | (vbval & 0b0111'1111u);
+		++frame.count;
+		if(!(vbval & 0b1000'0000u)) return true;
+	}
+	return false;
+}
+
+// Skips frame.count bytes.
+inline scan_result scan_skip_step(scan_state& state, std::size_t frame_index) {
+	auto& frame = state.frames[frame_index];
+	auto n = std::min(frame.count, state.remaining());
+	state.offset += n;
+	frame.count -= n;
+	return frame.count == 0 ? scan_result::complete : scan_result::need_more;
+}
+inline scan_frame make_skip_frame(std::size_t bytes) {
+	return scan_frame{&scan_skip_step, 0, bytes, 0};
+}
+
+template <typename T, typename Enable>
+struct scanner {
+	static scan_frame make_frame() {
+		if constexpr(has_fixed_serialized_size_v<T>) {
+			return make_skip_frame(serialized_size<T>());
+		} else if constexpr(std::is_base_of_v<varint_serializer, serializer<T>>) {
+			return scan_frame{&varint_step};
+		} else if constexpr(std::is_base_of_v<dynamic_container_serializer<T>, serializer<T>>) {
+			return scan_frame{&container_step<typename T::value_type>};
+		} else if constexpr(std::is_base_of_v<borrowed_view_serializer<T>, serializer<T>>) {
+			return scan_frame{&container_step<typename borrowed_view_serializer<T>::element_type>};
+		} else if constexpr(std::is_base_of_v<bool_vector_serializer<T>, serializer<T>>) {
+			return scan_frame{&bool_vector_step};
+		} else if constexpr(std::is_base_of_v<array_serializer<T>, serializer<T>>) {
+			return scan_frame{&array_step, 0, detail::array_helper<T>::size};
+		} else if constexpr(std::is_base_of_v<presence_bitmap_serializer<T>, serializer<T>>) {
+			return scan_frame{&presence_bitmap_step};
+		} else if constexpr(std::is_aggregate_v<T> && !std::is_array_v<T>) {
+			static_assert(std::is_base_of_v<general_serializer<T>, serializer<T>>,
+						  "Scanning is only supported for types using the built-in serializers.");
+			return scan_frame{&fields_step};
+		} else {
+			static_assert(dependent_false<T>, "Scanning is only supported for types using the built-in serializers.");
+		}
+	}
+
+private:
+	static scan_result varint_step(scan_state& state, std::size_t frame_index) {
+		return scan_varint(state, state.frames[frame_index]) ? scan_result::complete : scan_result::need_more;
+	}
+
+	static scan_result bool_vector_step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		if(!scan_varint(state, frame)) return scan_result::need_more;
+		frame = make_skip_frame(bits_to_bytes(frame.value));
+		return scan_skip_step(state, frame_index);
+	}
+
+	template <typename Elem>
+	static scan_result container_step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		if(frame.phase == 0) {
+			if(!scan_varint(state, frame)) return scan_result::need_more;
+			frame.phase = 1;
+			frame.count = frame.value;
+			if constexpr(has_fixed_serialized_size_v<Elem>) {
+				// Elements don't need to be looked at individually, replace this frame by skipping all of them.
+				frame = make_skip_frame(checked_fixed_size_total(frame.count, serialized_size<Elem>()));
+				return scan_skip_step(state, frame_index);
+			}
+		}
+		if(frame.count == 0) return scan_result::complete;
+		--frame.count;
+		push_scan_frame<Elem>(state);
+		return scan_result::descend;
+	}
+
+	static scan_result array_step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		if(frame.count == 0) return scan_result::complete;
+		--frame.count;
+		push_scan_frame<typename detail::array_helper<T>::type>(state);
+		return scan_result::descend;
+	}
+
+	template <std::size_t... indseq>
+	static constexpr auto make_field_pushers(std::index_sequence<indseq...>) {
+		return std::array<void (*)(scan_state&), sizeof...(indseq)>{
+				&push_scan_frame<boost::pfr::tuple_element_t<indseq, T>>...};
+	}
+
+	struct presence_bitmap_field {
+		void (*push)(scan_state&);
+		bool optional;
+		std::size_t bit_index;
+	};
+	template <std::size_t... indseq>
+	static constexpr auto make_presence_bitmap_fields(std::index_sequence<indseq...>) {
+		using ser = presence_bitmap_serializer<T>;
+		return std::array<presence_bitmap_field, sizeof...(indseq)>{
+				presence_bitmap_field{&push_scan_frame<typename ser::template field_info<indseq>::value_type>,
+									  ser::template field_info<indseq>::optional,
+									  ser::template bit_index<indseq>}...};
+	}
+
+	// Phase 0 waits for the bitmap and stores its offset in frame.value, as it remains in the accumulated data. Phase
+	// i > 0 descends into field i - 1, unless it is an absent optional field.
+	static scan_result presence_bitmap_step(scan_state& state, std::size_t frame_index) {
+		using ser = presence_bitmap_serializer<T>;
+		constexpr auto bitmap_size = serialized_size<typename ser::bitmap>();
+		constexpr auto fields = make_presence_bitmap_fields(std::make_index_sequence<ser::field_count>{});
+		auto& frame = state.frames[frame_index];
+		if(frame.phase == 0) {
+			if(state.remaining() < bitmap_size) return scan_result::need_more;
+			frame.value = state.offset;
+			state.offset += bitmap_size;
+			frame.phase = 1;
+		}
+		while(frame.phase <= fields.size()) {
+			const auto& field = fields[frame.phase++ - 1];
+			if(field.optional) {
+				auto bitmap_byte = std::to_integer<std::uint8_t>(state.data[frame.value + field.bit_index / 8]);
+				if((bitmap_byte & (0x80u >> (field.bit_index % 8))) == 0) continue;
+			}
+			field.push(state);
+			return scan_result::descend;
+		}
+		return scan_result::complete;
+	}
+
+	static scan_result fields_step(scan_state& state, std::size_t frame_index) {
+		constexpr auto field_count = boost::pfr::tuple_size_v<T>;
+		constexpr auto pushers = make_field_pushers(std::make_index_sequence<field_count>{});
+		auto& frame = state.frames[frame_index];
+		if(frame.phase == field_count) return scan_result::complete;
+		pushers[frame.phase++](state);
+		return scan_result::descend;
+	}
+};
+
+template <typename... T>
+struct scanner<std::tuple<T...>, std::enable_if_t<!has_fixed_serialized_size_v<std::tuple<T...>>>> {
+	static_assert(std::is_base_of_v<tuple_serializer<T...>, serializer<std::tuple<T...>>>,
+				  "Scanning is only supported for types using the built-in serializers.");
+	static scan_frame make_frame() {
+		return scan_frame{&step};
+	}
+
+private:
+	static scan_result step(scan_state& state, std::size_t frame_index) {
+		constexpr std::array<void (*)(scan_state&), sizeof...(T)> pushers = {&push_scan_frame<T>...};
+		auto& frame = state.frames[frame_index];
+		if(frame.phase == sizeof...(T)) return scan_result::complete;
+		pushers[frame.phase++](state);
+		return scan_result::descend;
+	}
+};
+
+template <typename FT, typename ST>
+struct scanner<std::pair<FT, ST>, std::enable_if_t<!has_fixed_serialized_size_v<std::pair<FT, ST>>>> {
+	static_assert(std::is_base_of_v<pair_serializer<FT, ST>, serializer<std::pair<FT, ST>>>,
+				  "Scanning is only supported for types using the built-in serializers.");
+	static scan_frame make_frame() {
+		return scan_frame{&step};
+	}
+
+private:
+	static scan_result step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		switch(frame.phase++) {
+		case 0: push_scan_frame<FT>(state); return scan_result::descend;
+		case 1: push_scan_frame<ST>(state); return scan_result::descend;
+		default: return scan_result::complete;
+		}
+	}
+};
+
+template <typename... T>
+struct scanner<std::variant<T...>> {
+	static_assert(std::is_base_of_v<variant_serializer<T...>, serializer<std::variant<T...>>>,
+				  "Scanning is only supported for types using the built-in serializers.");
+	static scan_frame make_frame() {
+		return scan_frame{&step};
+	}
+
+private:
+	using index_type = sufficient_uint_t<sizeof...(T)>;
+	static scan_result step(scan_state& state, std::size_t frame_index) {
+		constexpr std::array<void (*)(scan_state&), sizeof...(T)> pushers = {&push_scan_frame<T>...};
+		auto& frame = state.frames[frame_index];
+		if(frame.phase > 0) return scan_result::complete;
+		// The index is only consumed once it is available completely.
+		if(state.remaining() < sizeof(index_type)) return scan_result::need_more;
+		std::size_t index = 0;
+		for(std::size_t i = 0; i < sizeof(index_type); ++i) {
+			index = (index << 8) | state.next_byte();
+		}
+		if(index >= sizeof...(T)) {
+			throw deserialization_data_error("Invalid variant index in serialized data.");
+		}
+		frame.phase = 1;
+		pushers[index](state);
+		return scan_result::descend;
+	}
+};
+
+template <typename T>
+struct scanner<std::optional<T>> {
+	static_assert(std::is_base_of_v<optional_serializer<T>, serializer<std::optional<T>>>,
+				  "Scanning is only supported for types using the built-in serializers.");
+	static scan_frame make_frame() {
+		return scan_frame{&step};
+	}
+
+private:
+	static scan_result step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		if(frame.phase > 0) return scan_result::complete;
+		if(state.remaining() < 1) return scan_result::need_more;
+		frame.phase = 1;
+		if(state.next_byte() == 0) return scan_result::complete;
+		push_scan_frame<T>(state);
+		return scan_result::descend;
+	}
+};
+
+// Runs the scan until it is complete (returns true) or until the data are exhausted (returns false).
+inline bool run_scan(scan_state& state) {
+	while(!state.frames.empty()) {
+		auto frame_index = state.frames.size() - 1;
+		auto res = state.frames[frame_index].step(state, frame_index);
+		if(res == scan_result::need_more) {
+			return false;
+		} else if(res == scan_result::complete) {
+			state.frames.pop_back();
+		}
+	}
+	return true;
+}
+
+} // namespace detail
+
+// Determines the length of the serialized representation of a T at the beginning of a byte sequence, without
+// deserializing it. The byte sequence can be supplied incrementally: When it is incomplete, the scanner remembers its
+// position in the structure of T and continues from there when it is resumed with more data.
+// Only supported for types that use the built-in serializers, as the scanner needs to know their structure.
+template <typename T>
+class serialized_size_scanner {
+	detail::scan_state state_;
+	bool started_ = false;
+
+public:
+	// Continues the scan using the given data, which must begin with the same bytes that were passed in previous calls
+	// since the last reset(), i.e. the caller accumulates the data and passes all of them every time.
+	// Returns the length of the serialized T, if the data contain it completely, and std::nullopt otherwise.
+	// Throws deserialization_data_error if the data are detected to be invalid.
+	std::optional<std::size_t> resume(std::span<const std::byte> data) {
+		if(!started_) {
+			state_.offset = 0;
+			detail::push_scan_frame<T>(state_);
+			started_ = true;
+		}
+		state_.data = data;
+		if(!detail::run_scan(state_)) return std::nullopt;
+		return state_.offset;
+	}
+
+	// Starts a new scan, e.g. for the next value, or after an error.
+	void reset() noexcept {
+		state_.frames.clear();
+		state_.offset = 0;
+		started_ = false;
+	}
+
+	// Number of bytes already consumed by the current scan.
+	std::size_t scanned_bytes() const noexcept {
+		return state_.offset;
+	}
+};
+
+// Determines the length of the serialized representation of a T at the beginning of data, or std::nullopt if data is
+// too short to contain it completely.
+template <typename T>
+std::optional<std::size_t> scan_serialized_size(std::span<const std::byte> data) {
+	serialized_size_scanner<T> scanner;
+	return scanner.resume(data);
+}
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_SCANNING_INCLUDED
@@ -17,6 +17,7 @@
 #pragma clang diagnostic pop
 #endif
 
+#include "error_code.hpp"
 #include "exceptions.hpp"
 #include <algorithm>
 #include <array>
@@ -25,18 +26,25 @@
 #include <climits>
 #include <cstddef>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <deque>
+#include <initializer_list>
 #include <limits>
 #include <list>
 #include <map>
+#include <memory_resource>
 #include <numeric>
 #include <optional>
 #include <set>
+#include <span>
 #include <string>
+#include <string_view>
 #include <structocol/type_utilities.hpp>
+#include <system_error>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -54,6 +62,16 @@ struct varint_t {
 	}
 };
 
+// Signed counterpart of varint_t, serialized like a varint_t of its ZigZag mapping (0, -1, 1, -2, ... mapped to
+// 0, 1, 2, 3, ...), so that values of small magnitude need few bytes regardless of their sign.
+struct signed_varint_t {
+	std::ptrdiff_t value;
+	signed_varint_t(std::ptrdiff_t value) : value{value} {}
+	operator std::ptrdiff_t() const {
+		return value;
+	}
+};
+
 template <auto... values>
 struct magic_number {};
 
@@ -64,27 +82,350 @@ static_assert(CHAR_BIT == 8, "(De)Serialization is only supported for architectu
 // bump its format version when the assert breaks
 // or
 // - Determine its corresponding version signature using constexpr code based on this constant
-constexpr std::uint32_t format_version_signature = 2020'08'25u;
+constexpr std::uint32_t format_version_signature = 2026'10'17u;
 // Format version history:
 // - 2019'03'30: Initial binary format
 // - 2020'08'25: Fixed endianess of floating point values to big endian (breaks format on little endian architectures,
 //               big endian was chosen for consistency with integer network byte order).
+// - 2026'10'17: std::vector<bool> is bit-packed like std::bitset instead of using one byte per element.
+
+// Wire format policies, that select the encoding of integers and floating point values, see serialize<Policy>.
+// big_endian_format is the default format, as described above.
+// little_endian_format stores integers and floating point values in little endian byte order, which avoids the byte
+// swapping on little endian architectures, for data that are only exchanged between those.
+// varint_format stores integers wider than one byte as varint_t (using the ZigZag mapping of signed_varint_t for signed
+// integers) and floating point values like big_endian_format. This makes small values shorter, but the serialized size
+// of every type containing integers variable.
+// Each policy has its own version signature, that changes together with format_version_signature, so that data in a
+// different format are detected when checking a signature (see format_version_magic_number_for_t).
+struct big_endian_format {
+	static constexpr std::endian byte_order = std::endian::big;
+	static constexpr bool varint_integers = false;
+	static constexpr std::uint32_t version_signature = format_version_signature;
+};
+struct little_endian_format {
+	static constexpr std::endian byte_order = std::endian::little;
+	static constexpr bool varint_integers = false;
+	static constexpr std::uint32_t version_signature = format_version_signature | 0x1000'0000u;
+};
+struct varint_format {
+	static constexpr std::endian byte_order = std::endian::big;
+	static constexpr bool varint_integers = true;
+	static constexpr std::uint32_t version_signature = format_version_signature | 0x2000'0000u;
+};
+// The fixed-width format without byte swapping on the current architecture.
+using native_format =
+		std::conditional_t<std::endian::native == std::endian::little, little_endian_format, big_endian_format>;
+
+template <typename, typename = std::void_t<>>
+struct is_format_policy : std::false_type {};
+template <typename T>
+struct is_format_policy<T, std::void_t<decltype(std::endian{T::byte_order}), decltype(bool{T::varint_integers}),
+									   decltype(std::uint32_t{T::version_signature})>> : std::true_type {};
+template <typename T>
+inline constexpr bool is_format_policy_v = is_format_policy<T>::value;
 
 // Can be used to easily put a version tag into some header and error-out if it doesn't match on deserialize.
-using format_version_magic_number_t =
-		magic_number<(format_version_signature >> 24) & 0xFF, (format_version_signature >> 16) & 0xFF,
-					 (format_version_signature >> 8) & 0xFF, format_version_signature & 0xFF>;
+template <typename Policy>
+using format_version_magic_number_for_t =
+		magic_number<(Policy::version_signature >> 24) & 0xFF, (Policy::version_signature >> 16) & 0xFF,
+					 (Policy::version_signature >> 8) & 0xFF, Policy::version_signature & 0xFF>;
+using format_version_magic_number_t = format_version_magic_number_for_t<big_endian_format>;
 constexpr format_version_magic_number_t format_version_magic_number{};
 
+// Bounds for the resources that a single deserialization may consume, for decoding data from untrusted sources.
+// A deserialization exceeding them fails with decode_limit_error or errc::limit_exceeded.
+struct decode_limits {
+	// Maximum number of elements of each container (including strings).
+	std::size_t max_elements = std::numeric_limits<std::size_t>::max();
+	// Maximum number of bytes for the elements of all containers in one deserialization, counted as their number
+	// times the in-memory size of the element type.
+	std::size_t max_total_bytes = std::numeric_limits<std::size_t>::max();
+	// Maximum nesting depth of containers.
+	std::size_t max_depth = std::numeric_limits<std::size_t>::max();
+};
+
 template <typename Buff, typename T>
 void serialize(Buff& buffer, const T& val);
 template <typename T, typename Buff>
 T deserialize(Buff& buffer);
+template <typename Buff, typename T>
+void deserialize_into(Buff& buffer, T& target);
+template <typename T, typename Buff>
+void skip(Buff& buffer);
+template <typename T, typename Buff>
+void validate(Buff& buffer);
 template <typename T>
 constexpr std::size_t serialized_size();
 template <typename T>
 std::size_t serialized_size(const T& val);
 
+namespace detail {
+template <typename T>
+struct fixed_size_helper;
+
+// ZigZag mapping of signed integers to unsigned integers, interleaving negative and non-negative values.
+template <typename T>
+constexpr std::make_unsigned_t<T> zigzag_encode(T val) noexcept {
+	using U = std::make_unsigned_t<T>;
+	return U(U(val) << 1) ^ (val < 0 ? U(~U(0)) : U(0));
+}
+template <typename U>
+constexpr std::make_signed_t<U> zigzag_decode(U val) noexcept {
+	return std::make_signed_t<U>(U(val >> 1) ^ U(0 - U(val & 1)));
+}
+} // namespace detail
+
+// Indicates if all values of T have the same serialized size, i.e. if serialized_size<T>() can be used.
+template <typename T>
+constexpr bool has_fixed_serialized_size_v = detail::fixed_size_helper<std::remove_cv_t<T>>::value();
+
+namespace detail {
+template <typename T, typename Policy>
+struct max_size_helper;
+}
+
+// Indicates if the serialized size of T in the given format has an upper bound, i.e. if max_serialized_size<T>() can be
+// used. This is the case for types with a fixed serialized size, varint_t, and variants, optionals, arrays, tuples,
+// pairs and aggregates of such types, but not for containers. Serializers of other types can declare a bound by
+// providing a static constexpr max_size() member function.
+template <typename T, typename Policy = big_endian_format>
+constexpr bool has_bounded_serialized_size_v =
+		detail::max_size_helper<std::remove_cv_t<T>, Policy>::value().has_value();
+
+namespace detail {
+template <typename, typename = std::void_t<>>
+struct has_error_reporting_members : std::false_type {};
+template <typename T>
+struct has_error_reporting_members<T, std::void_t<decltype(std::declval<T&>().report_error(errc::invalid_data)),
+												   decltype(bool{std::declval<const T&>().failed()})>>
+		: std::true_type {};
+
+// Reports invalid data encountered during deserialization. This throws deserialization_data_error, unless the buffer
+// records errors instead (as done by try_deserialize), in which case the caller continues with a dummy value.
+template <typename Buff>
+void report_data_error(Buff& buffer, const char* message) {
+	if constexpr(has_error_reporting_members<Buff>::value) {
+		buffer.report_error(errc::invalid_data);
+	} else {
+		throw deserialization_data_error(message);
+	}
+}
+
+template <typename, typename = std::void_t<>>
+struct has_decode_limits_members : std::false_type {};
+template <typename T>
+struct has_decode_limits_members<
+		T, std::void_t<decltype(bool{std::declval<T&>().enter_container(std::size_t{}, std::size_t{})}),
+					   decltype(std::declval<T&>().leave_container())>> : std::true_type {};
+
+// Checks a container length read from the data against the decode limits of the buffer (if it has them) and accounts
+// for the nesting of the container while the scope exists.
+// If the container isn't admitted, the limit violation was already reported and the container must not be decoded.
+template <typename Buff>
+class container_scope {
+	Buff& buffer_;
+	bool admitted_ = true;
+
+public:
+	container_scope(Buff& buffer, std::size_t length, std::size_t element_bytes) : buffer_{buffer} {
+		if constexpr(has_decode_limits_members<Buff>::value) {
+			admitted_ = buffer_.enter_container(length, element_bytes);
+		} else {
+			static_cast<void>(length);
+			static_cast<void>(element_bytes);
+		}
+	}
+	~container_scope() {
+		if constexpr(has_decode_limits_members<Buff>::value) {
+			if(admitted_) buffer_.leave_container();
+		}
+	}
+	container_scope(const container_scope&) = delete;
+	container_scope& operator=(const container_scope&) = delete;
+
+	bool admitted() const noexcept {
+		return admitted_;
+	}
+};
+
+template <typename, typename = std::void_t<>>
+struct has_memory_resource_member : std::false_type {};
+template <typename T>
+struct has_memory_resource_member<
+		T, std::void_t<decltype(static_cast<std::pmr::memory_resource*>(std::declval<const T&>().memory_resource()))>>
+		: std::true_type {};
+
+// Creates an empty container for deserialization. If the container uses std::pmr::polymorphic_allocator and the buffer
+// supplies a memory resource, the container allocates from that resource.
+template <typename C, typename Buff>
+C make_empty_container(Buff& buffer) {
+	if constexpr(has_memory_resource_member<Buff>::value &&
+				 std::uses_allocator_v<C, std::pmr::polymorphic_allocator<std::byte>>) {
+		return C(typename C::allocator_type(buffer.memory_resource()));
+	} else {
+		static_cast<void>(buffer);
+		return C();
+	}
+}
+
+// Lower bound of the serialized size of any T, or 0 if unknown.
+template <typename T>
+struct min_size_helper;
+
+// The wire format policy used for (de)serializing through a buffer. Buffers select it by declaring a format_policy
+// member type, which the buffer adapters of the library do to apply a policy or forward that of the adapted buffer.
+template <typename Buff, typename = std::void_t<>>
+struct buffer_format {
+	using type = big_endian_format;
+};
+template <typename Buff>
+struct buffer_format<Buff, std::void_t<typename Buff::format_policy>> {
+	using type = typename Buff::format_policy;
+};
+template <typename Buff>
+using buffer_format_t = typename buffer_format<Buff>::type;
+
+// Indicates if T has a fixed serialized size in the format of the buffer. As varint_format makes all integers variable
+// length, types are conservatively treated as variable length in it.
+template <typename T, typename Buff>
+constexpr bool has_fixed_size_in_format_v = has_fixed_serialized_size_v<T> && !buffer_format_t<Buff>::varint_integers;
+
+// Indicates if an error was recorded by the buffer, to let loops over element counts bail out early.
+// Always false for buffers that don't record errors, as they throw instead.
+template <typename Buff>
+constexpr bool deserialization_failed(const Buff& buffer) noexcept {
+	if constexpr(has_error_reporting_members<Buff>::value) {
+		return buffer.failed();
+	} else {
+		static_cast<void>(buffer);
+		return false;
+	}
+}
+} // namespace detail
+
+struct varint_serializer {
+	template <typename Buff>
+	static void serialize(Buff& buffer, std::size_t val) {
+		// Encode into a local array first, to write the whole value with one buffer operation.
+		auto varbytes = size(val);
+		std::array<std::byte, max_bytes> data;
+		for(std::size_t varbyte = 0; varbyte < varbytes; ++varbyte) {
+			unsigned char vbval = (val >> ((varbytes - 1 - varbyte) * 7)) & 0b0111'1111;
+			if(varbyte + 1 < varbytes) vbval |= 0b1000'0000;
+			data[varbyte] = std::byte(vbval);
+		}
+		write_encoded(buffer, data, varbytes);
+	}
+	template <typename Buff>
+	static std::size_t deserialize(Buff& buffer) {
+		if constexpr(has_available_data_member_v<Buff> && has_skip_member_v<Buff>) {
+			// Decode directly from the buffer storage, if the whole value is available there, which is the case except
+			// near the end of the data.
+			auto window = buffer.available_data();
+			auto window_size = std::min(window.size(), max_bytes);
+			for(std::size_t len = 0; len < window_size; ++len) {
+				if(!(std::to_integer<unsigned char>(window[len]) & 0b1000'0000)) {
+					return deserialize_window(buffer, window.first(len + 1));
+				}
+			}
+		}
+		std::size_t val = 0;
+		bool cont = true;
+		while(cont) {
+			unsigned char vbval = std::to_integer<unsigned char>(buffer.template read<1>().front());
+			cont = vbval & 0b1000'0000;
+			if(((val << 7) >> 7) != val) {
+				detail::report_data_error(buffer, "Could not deserialize structocol::varint_t value because it is too "
+												  "large for std::size_t on this platform.");
+				return 0;
+			}
+			val = (val << 7) | (vbval & 0b0111'1111);
+		}
+		return val;
+	}
+	static std::size_t size(std::size_t val) {
+		int bits = required_bits(val);
+		int varbytes = bits / 7 + ((bits % 7) ? 1 : 0);
+		return varbytes;
+	}
+	static constexpr std::size_t max_size() noexcept {
+		return max_bytes;
+	}
+
+private:
+	// Maximum length of the encoding of a std::size_t, without redundant leading zero groups.
+	static constexpr std::size_t max_bytes = (sizeof(std::size_t) * CHAR_BIT + 6) / 7;
+
+	template <std::size_t bytes = 1, typename Buff>
+	static void write_encoded(Buff& buffer, const std::array<std::byte, max_bytes>& data, std::size_t length) {
+		if constexpr(bytes < max_bytes) {
+			if(length != bytes) {
+				write_encoded<bytes + 1>(buffer, data, length);
+				return;
+			}
+		}
+		std::array<std::byte, bytes> encoded;
+		std::copy_n(data.begin(), bytes, encoded.begin());
+		buffer.write(encoded);
+	}
+
+	// Decodes a complete encoded value, i.e. only the last byte lacks the continuation bit.
+	template <typename Buff>
+	static std::size_t deserialize_window(Buff& buffer, std::span<const std::byte> encoded) {
+		// Only the longest encoding can have more significant bits than std::size_t.
+		constexpr auto excess_bits = max_bytes * 7 - sizeof(std::size_t) * CHAR_BIT;
+		auto first_group = std::to_integer<unsigned char>(encoded[0]) & 0b0111'1111;
+		if(encoded.size() == max_bytes && (first_group >> (7 - excess_bits)) != 0) {
+			detail::report_data_error(buffer, "Could not deserialize structocol::varint_t value because it is too "
+											  "large for std::size_t on this platform.");
+			return 0;
+		}
+		std::size_t val = 0;
+		for(auto b : encoded) {
+			val = (val << 7) | (std::to_integer<unsigned char>(b) & 0b0111'1111);
+		}
+		buffer.skip(encoded.size());
+		return val;
+	}
+
+	static int required_bits(std::size_t val) {
+#if defined(__clang__) || defined(__GNUC__)
+		unsigned long long v{val | 1};
+		return CHAR_BIT * sizeof(val) - __builtin_clzll(v);
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned __int64 v{val | 1};
+		unsigned long index = 0;
+		_BitScanReverse64(&index, v);
+		return index + 1;
+#elif defined(_MSC_VER) && !defined(_WIN64)
+		unsigned long v{val | 1};
+		unsigned long index = 0;
+		_BitScanReverse(&index, v);
+		return index + 1;
+#else
+		int num = 1;
+		while(val >>= 1) num++;
+		return num;
+#endif
+	}
+};
+
+// Derived from varint_serializer, as the serialized form is a varint_t and can be scanned and skipped as one.
+struct signed_varint_serializer : varint_serializer {
+	template <typename Buff>
+	static void serialize(Buff& buffer, std::ptrdiff_t val) {
+		varint_serializer::serialize(buffer, detail::zigzag_encode(val));
+	}
+	template <typename Buff>
+	static std::ptrdiff_t deserialize(Buff& buffer) {
+		return detail::zigzag_decode(varint_serializer::deserialize(buffer));
+	}
+	static std::size_t size(std::ptrdiff_t val) {
+		return varint_serializer::size(detail::zigzag_encode(val));
+	}
+};
+
 template <typename T>
 struct single_byte_serializer {
 	template <typename Buff>
@@ -93,7 +434,11 @@ struct single_byte_serializer {
 	}
 	template <typename Buff>
 	static T deserialize(Buff& buffer) {
-		return std::to_integer<T>(buffer.template read<1>().front());
+		if constexpr(std::is_same_v<T, std::byte>) {
+			return buffer.template read<1>().front();
+		} else {
+			return std::to_integer<T>(buffer.template read<1>().front());
+		}
 	}
 	static constexpr std::size_t size() {
 		return 1;
@@ -103,31 +448,41 @@ struct single_byte_serializer {
 	}
 };
 
+// Serializes integers as big endian by default, or as specified by the format policy of the buffer.
 template <typename T>
-struct integral_big_endian_serializer {
+struct integral_serializer {
 	template <typename Buff>
 	static void serialize(Buff& buffer, T val) {
-		uint uval = val;
-		std::array<std::byte, sizeof(T)> data;
-		for(std::size_t i = 0; i < sizeof(T); i++) {
-			std::size_t shift = (sizeof(T) - 1 - i) * CHAR_BIT;
-			uint mask = uint(0xFFu) << shift;
-			data[i] = std::byte((uval & mask) >> shift);
+		using format = detail::buffer_format_t<Buff>;
+		if constexpr(format::varint_integers) {
+			serialize_varint(buffer, val);
+		} else {
+			uint uval = val;
+			std::array<std::byte, sizeof(T)> data;
+			for(std::size_t i = 0; i < sizeof(T); i++) {
+				std::size_t shift = byte_shift<format>(i);
+				uint mask = uint(0xFFu) << shift;
+				data[i] = std::byte((uval & mask) >> shift);
+			}
+			buffer.write(data);
 		}
-		buffer.write(data);
 	}
 	template <typename Buff>
 	static T deserialize(Buff& buffer) {
-		auto data = buffer.template read<sizeof(T)>();
-		uint val = 0;
-		for(std::size_t i = 0; i < sizeof(T); i++) {
-			std::size_t shift = (sizeof(T) - 1 - i) * CHAR_BIT;
-			val |= std::to_integer<uint>(data[i]) << shift;
-		}
-		if constexpr(std::is_signed_v<T>) {
-			return to_signed(val);
+		using format = detail::buffer_format_t<Buff>;
+		if constexpr(format::varint_integers) {
+			return deserialize_varint(buffer);
 		} else {
-			return val;
+			auto data = buffer.template read<sizeof(T)>();
+			uint val = 0;
+			for(std::size_t i = 0; i < sizeof(T); i++) {
+				val |= std::to_integer<uint>(data[i]) << byte_shift<format>(i);
+			}
+			if constexpr(std::is_signed_v<T>) {
+				return to_signed(buffer, val);
+			} else {
+				return val;
+			}
 		}
 	}
 
@@ -140,24 +495,66 @@ struct integral_big_endian_serializer {
 
 private:
 	using uint = std::make_unsigned_t<T>;
-	static T to_signed(uint val) {
+
+	// Shift of the byte at the given position of the serialized form within the value.
+	template <typename Format>
+	static constexpr std::size_t byte_shift(std::size_t pos) noexcept {
+		if constexpr(Format::byte_order == std::endian::big) {
+			return (sizeof(T) - 1 - pos) * CHAR_BIT;
+		} else {
+			return pos * CHAR_BIT;
+		}
+	}
+
+	template <typename Buff>
+	static void serialize_varint(Buff& buffer, T val) {
+		static_assert(sizeof(T) <= sizeof(std::size_t),
+					  "varint_format supports only integers that fit into std::size_t on this platform.");
+		if constexpr(std::is_signed_v<T>) {
+			signed_varint_serializer::serialize(buffer, val);
+		} else {
+			varint_serializer::serialize(buffer, val);
+		}
+	}
+	template <typename Buff>
+	static T deserialize_varint(Buff& buffer) {
+		static_assert(sizeof(T) <= sizeof(std::size_t),
+					  "varint_format supports only integers that fit into std::size_t on this platform.");
+		if constexpr(std::is_signed_v<T>) {
+			auto val = signed_varint_serializer::deserialize(buffer);
+			if(val >= std::numeric_limits<T>::min() && val <= std::numeric_limits<T>::max()) return T(val);
+		} else {
+			auto val = varint_serializer::deserialize(buffer);
+			if(val <= std::numeric_limits<T>::max()) return T(val);
+		}
+		detail::report_data_error(buffer, "Value not representable in target type.");
+		return 0;
+	}
+
+	template <typename Buff>
+	static T to_signed(Buff& buffer, uint val) {
 		// See https://stackoverflow.com/a/13208789
 		constexpr auto min = std::numeric_limits<T>::min();
 		if(val <= static_cast<uint>(min)) return static_cast<T>(val);
 		if(val >= static_cast<uint>(min)) return static_cast<T>(val - static_cast<uint>(min)) + min;
-		throw deserialization_data_error("Value not representable in target type.");
+		detail::report_data_error(buffer, "Value not representable in target type.");
+		return 0;
 	}
 };
+// Former name from when integers were always serialized as big endian, kept for existing serializer specializations.
+template <typename T>
+using integral_big_endian_serializer = integral_serializer<T>;
 
+// Serializes IEEE 754 values in big endian byte order by default, or as specified by the format policy of the buffer.
 template <typename T>
 struct floating_point_serializer {
 	template <typename Buff>
 	static void serialize(Buff& buffer, T val) {
 		validity_checks<T>();
 		std::array<std::byte, sizeof(T)> data{};
-		if constexpr(std::endian::native == std::endian::big) {
+		if constexpr(std::endian::native == detail::buffer_format_t<Buff>::byte_order) {
 			std::memcpy(data.data(), &val, sizeof(T));
-		} else if constexpr(std::endian::native == std::endian::little) {
+		} else if constexpr(std::endian::native == std::endian::little || std::endian::native == std::endian::big) {
 			// Working on a separate buffer allows for better optimization on some compilers (becomes bswap on clang).
 			std::array<std::byte, sizeof(T)> tmp{};
 			std::memcpy(tmp.data(), &val, sizeof(T));
@@ -174,9 +571,9 @@ struct floating_point_serializer {
 		validity_checks<T>();
 		auto data = buffer.template read<sizeof(T)>();
 		T val{};
-		if constexpr(std::endian::native == std::endian::big) {
+		if constexpr(std::endian::native == detail::buffer_format_t<Buff>::byte_order) {
 			std::memcpy(&val, data.data(), sizeof(T));
-		} else if constexpr(std::endian::native == std::endian::little) {
+		} else if constexpr(std::endian::native == std::endian::little || std::endian::native == std::endian::big) {
 			// Working on a separate buffer allows for better optimization on some compilers (becomes bswap on clang).
 			std::array<std::byte, sizeof(T)> tmp{};
 			std::reverse_copy(data.begin(), data.end(), tmp.begin());
@@ -219,89 +616,453 @@ private:
 	}
 };
 
-struct varint_serializer {
-	template <typename Buff>
-	static void serialize(Buff& buffer, std::size_t val) {
-		int bits = required_bits(val);
-		int varbytes = bits / 7 + ((bits % 7) ? 1 : 0);
-		for(int varbyte = varbytes - 1; varbyte > 0; --varbyte) {
-			unsigned char vbval = (val >> (varbyte * 7)) & 0b0111'1111;
-			vbval |= 0b1000'0000;
-			buffer.write(std::array{std::byte(vbval)});
-		}
-		unsigned char vbval = val & 0b0111'1111;
-		buffer.write(std::array{std::byte(vbval)});
-	}
-	template <typename Buff>
-	static std::size_t deserialize(Buff& buffer) {
-		std::size_t val = 0;
-		bool cont = true;
-		while(cont) {
-			unsigned char vbval = std::to_integer<unsigned char>(buffer.template read<1>().front());
-			cont = vbval & 0b1000'0000;
-			if(((val << 7) >> 7) != val) {
-				throw deserialization_data_error(
-						"Could not deserialize structocol::varint_t value because it is too large "
-						"for std::size_t on this platform.");
-			}
-			val = (val << 7) | (vbval & 0b0111'1111);
-		}
-		return val;
-	}
-	static std::size_t size(std::size_t val) {
-		int bits = required_bits(val);
-		int varbytes = bits / 7 + ((bits % 7) ? 1 : 0);
-		return varbytes;
-	}
+template <typename T>
+struct serializer;
 
-private:
-	static int required_bits(std::size_t val) {
+namespace detail {
+
+template <std::size_t size>
+struct unsigned_of_size {};
+template <>
+struct unsigned_of_size<2> {
+	using type = std::uint16_t;
+};
+template <>
+struct unsigned_of_size<4> {
+	using type = std::uint32_t;
+};
+template <>
+struct unsigned_of_size<8> {
+	using type = std::uint64_t;
+};
+
+inline std::uint16_t byteswap(std::uint16_t val) noexcept {
 #if defined(__clang__) || defined(__GNUC__)
-		unsigned long long v{val | 1};
-		return CHAR_BIT * sizeof(val) - __builtin_clzll(v);
-#elif defined(_MSC_VER) && defined(_WIN64)
-		unsigned __int64 v{val | 1};
-		unsigned long index = 0;
-		_BitScanReverse64(&index, v);
-		return index + 1;
-#elif defined(_MSC_VER) && !defined(_WIN64)
-		unsigned long v{val | 1};
-		unsigned long index = 0;
-		_BitScanReverse(&index, v);
-		return index + 1;
+	return __builtin_bswap16(val);
+#elif defined(_MSC_VER)
+	return _byteswap_ushort(val);
 #else
-		int num = 1;
-		while(val >>= 1) num++;
-		return num;
+	return std::uint16_t((val >> 8) | (val << 8));
+#endif
+}
+inline std::uint32_t byteswap(std::uint32_t val) noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+	return __builtin_bswap32(val);
+#elif defined(_MSC_VER)
+	return _byteswap_ulong(val);
+#else
+	return (std::uint32_t(byteswap(std::uint16_t(val))) << 16) | byteswap(std::uint16_t(val >> 16));
+#endif
+}
+inline std::uint64_t byteswap(std::uint64_t val) noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+	return __builtin_bswap64(val);
+#elif defined(_MSC_VER)
+	return _byteswap_uint64(val);
+#else
+	return (std::uint64_t(byteswap(std::uint32_t(val))) << 32) | byteswap(std::uint32_t(val >> 32));
 #endif
+}
+
+// Determines if a contiguous sequence of T can be (de)serialized as one block, i.e. if the serialized form of each
+// element in the given format is just its object representation in the byte order of the format, as produced by
+// single_byte_serializer, integral_serializer and floating_point_serializer. Only applies if serializer<T>
+// wasn't customized to something else. bool is excluded because not every byte value is a valid bool object
+// representation.
+template <typename T, typename Format>
+constexpr bool is_bulk_element() {
+	if constexpr(std::is_same_v<T, std::byte>) {
+		return std::is_base_of_v<single_byte_serializer<T>, serializer<T>>;
+	} else if constexpr(!std::is_arithmetic_v<T> || std::is_same_v<T, bool>) {
+		return false;
+	} else if constexpr(std::is_base_of_v<single_byte_serializer<T>, serializer<T>>) {
+		return sizeof(T) == 1;
+	} else if constexpr(std::endian::native != std::endian::big && std::endian::native != std::endian::little) {
+		return false;
+	} else if constexpr(std::is_base_of_v<integral_serializer<T>, serializer<T>>) {
+		return !Format::varint_integers;
+	} else if constexpr(std::is_base_of_v<floating_point_serializer<T>, serializer<T>>) {
+		// Instantiate the static checks of floating_point_serializer:
+		return serializer<T>::size() == sizeof(T);
+	} else {
+		return false;
 	}
-};
+}
+
+// Indicates if every byte sequence of the serialized size of T represents a valid T, i.e. if validating a serialized T
+// only requires checking that the data are present.
+template <typename T, typename Format>
+constexpr bool is_always_valid() {
+	if constexpr(std::is_same_v<T, bool>) {
+		return std::is_base_of_v<single_byte_serializer<T>, serializer<T>>;
+	} else {
+		return is_bulk_element<T, Format>();
+	}
+}
 
 template <typename T>
-struct dynamic_container_serializer {
-	template <typename Buff>
-	static void serialize(Buff& buffer, const T& val) {
-		structocol::varint_serializer::serialize(buffer, val.size());
-		for(const auto& elem : val) {
-			structocol::serialize(buffer, elem);
-		}
+struct is_contiguous_container : std::false_type {};
+template <typename T, typename Alloc>
+struct is_contiguous_container<std::vector<T, Alloc>> : std::true_type {};
+template <typename Alloc>
+struct is_contiguous_container<std::vector<bool, Alloc>> : std::false_type {};
+template <typename T, typename Traits, typename Alloc>
+struct is_contiguous_container<std::basic_string<T, Traits, Alloc>> : std::true_type {};
+template <typename T, std::size_t N>
+struct is_contiguous_container<std::array<T, N>> : std::true_type {};
+template <typename T, std::size_t N>
+struct is_contiguous_container<T[N]> : std::true_type {};
+
+template <typename C, typename Format>
+constexpr bool is_bulk_container() {
+	if constexpr(is_contiguous_container<C>::value) {
+		return is_bulk_element<std::remove_cv_t<std::remove_reference_t<decltype(*std::data(std::declval<C&>()))>>,
+							   Format>();
+	} else {
+		return false;
 	}
-	template <typename Buff>
-	static T deserialize(Buff& buffer) {
-		T val;
-		auto size = structocol::varint_serializer::deserialize(buffer);
-		for(std::uint64_t i = 0; i < size; ++i) {
-			val.insert(val.end(), structocol::deserialize<typename T::value_type>(buffer));
+}
+
+// Size of the blocks used to stage the data of bulk operations.
+constexpr std::size_t bulk_block_size = 1024;
+// Number of bytes by which containers are grown at once, when they are filled in bulk as the data arrive.
+constexpr std::size_t bulk_growth_step = 0x10000u;
+
+template <typename T, typename Format>
+constexpr bool bulk_needs_byteswap = sizeof(T) > 1 && std::endian::native != Format::byte_order;
+
+// Converts between the native object representation and the serialized form in the byte order of the format for
+// count elements. Written as a plain loop over the elements to allow the compiler to vectorize the byte swapping.
+template <typename Format, typename T>
+void bulk_encode(const T* src, std::size_t count, std::byte* dst) noexcept {
+	if constexpr(!bulk_needs_byteswap<T, Format>) {
+		std::memcpy(dst, src, count * sizeof(T));
+	} else {
+		using uint = typename unsigned_of_size<sizeof(T)>::type;
+		for(std::size_t i = 0; i < count; ++i) {
+			uint tmp;
+			std::memcpy(&tmp, src + i, sizeof(T));
+			tmp = byteswap(tmp);
+			std::memcpy(dst + i * sizeof(T), &tmp, sizeof(T));
 		}
-		return val;
 	}
-	static std::size_t size(const T& val) {
-		return std::accumulate(val.begin(), val.end(), structocol::varint_serializer::size(val.size()),
-							   [](std::size_t s, const auto& e) { return s + structocol::serialized_size(e); });
+}
+template <typename T>
+void bulk_byteswap_in_place(T* data, std::size_t count) noexcept {
+	using uint = typename unsigned_of_size<sizeof(T)>::type;
+	for(std::size_t i = 0; i < count; ++i) {
+		uint tmp;
+		std::memcpy(&tmp, data + i, sizeof(T));
+		tmp = byteswap(tmp);
+		std::memcpy(data + i, &tmp, sizeof(T));
 	}
-};
+}
+template <typename Format, typename T>
+void bulk_decode(const std::byte* src, std::size_t count, T* dst) noexcept {
+	if constexpr(!bulk_needs_byteswap<T, Format>) {
+		std::memcpy(dst, src, count * sizeof(T));
+	} else {
+		using uint = typename unsigned_of_size<sizeof(T)>::type;
+		for(std::size_t i = 0; i < count; ++i) {
+			uint tmp;
+			std::memcpy(&tmp, src + i * sizeof(T), sizeof(T));
+			tmp = byteswap(tmp);
+			std::memcpy(dst + i, &tmp, sizeof(T));
+		}
+	}
+}
 
-template <typename... T>
+// The remainder that doesn't fill a full block is transferred in power-of-two-sized parts, as the buffer interface
+// only supports compile-time sizes. This bounds the number of buffer operations for it to log2 of the block length.
+template <std::size_t elems, typename T, typename Buff>
+void bulk_write_remainder(Buff& buffer, const T* data, std::size_t count) {
+	if constexpr(elems > 0) {
+		if(count >= elems) {
+			std::array<std::byte, elems * sizeof(T)> block;
+			bulk_encode<buffer_format_t<Buff>>(data, elems, block.data());
+			buffer.write(block);
+			data += elems;
+			count -= elems;
+		}
+		bulk_write_remainder<elems / 2>(buffer, data, count);
+	} else {
+		static_cast<void>(buffer);
+		static_cast<void>(data);
+		static_cast<void>(count);
+	}
+}
+template <std::size_t elems, typename T, typename Buff>
+void bulk_read_remainder(Buff& buffer, T* data, std::size_t count) {
+	if constexpr(elems > 0) {
+		if(count >= elems) {
+			auto block = buffer.template read<elems * sizeof(T)>();
+			bulk_decode<buffer_format_t<Buff>>(block.data(), elems, data);
+			data += elems;
+			count -= elems;
+		}
+		bulk_read_remainder<elems / 2>(buffer, data, count);
+	} else {
+		static_cast<void>(buffer);
+		static_cast<void>(data);
+		static_cast<void>(count);
+	}
+}
+
+template <typename T>
+constexpr std::size_t bulk_block_elements = bulk_block_size / sizeof(T);
+
+template <typename T, typename Buff>
+void bulk_write(Buff& buffer, const T* data, std::size_t count) {
+	using format = buffer_format_t<Buff>;
+	constexpr auto block_elems = bulk_block_elements<T>;
+	static_assert(std::has_single_bit(block_elems));
+	if constexpr(has_span_write_member_v<Buff> && !bulk_needs_byteswap<T, format>) {
+		buffer.write(std::as_bytes(std::span(data, count)));
+	} else if constexpr(has_span_write_member_v<Buff>) {
+		std::array<std::byte, block_elems * sizeof(T)> block;
+		while(count > 0) {
+			auto step = std::min(count, block_elems);
+			bulk_encode<format>(data, step, block.data());
+			buffer.write(std::span<const std::byte>(block.data(), step * sizeof(T)));
+			data += step;
+			count -= step;
+		}
+	} else {
+		std::array<std::byte, block_elems * sizeof(T)> block;
+		for(; count >= block_elems; count -= block_elems, data += block_elems) {
+			bulk_encode<format>(data, block_elems, block.data());
+			buffer.write(block);
+		}
+		bulk_write_remainder<block_elems / 2>(buffer, data, count);
+	}
+}
+template <typename T, typename Buff>
+void bulk_read(Buff& buffer, T* data, std::size_t count) {
+	using format = buffer_format_t<Buff>;
+	constexpr auto block_elems = bulk_block_elements<T>;
+	static_assert(std::has_single_bit(block_elems));
+	if constexpr(has_read_into_member_v<Buff>) {
+		buffer.read_into(std::as_writable_bytes(std::span(data, count)));
+		if constexpr(bulk_needs_byteswap<T, format>) {
+			bulk_byteswap_in_place(data, count);
+		}
+	} else {
+		for(; count >= block_elems; count -= block_elems, data += block_elems) {
+			auto block = buffer.template read<block_elems * sizeof(T)>();
+			bulk_decode<format>(block.data(), block_elems, data);
+		}
+		bulk_read_remainder<block_elems / 2>(buffer, data, count);
+	}
+}
+
+// Reads count elements, appending them to the given resizable contiguous container.
+// The container is grown step-wise as the data arrive, so that a bogus element count can't cause a huge allocation
+// before running out of data.
+template <typename C, typename Buff>
+void bulk_read_append(Buff& buffer, C& container, std::size_t count) {
+	using T = typename C::value_type;
+	constexpr auto step_elems = bulk_growth_step / sizeof(T);
+	while(count > 0 && !deserialization_failed(buffer)) {
+		auto step = std::min(count, step_elems);
+		auto old_size = container.size();
+		container.resize(old_size + step);
+		bulk_read(buffer, container.data() + old_size, step);
+		count -= step;
+	}
+}
+
+// Consumes the given number of bytes from the buffer without interpreting them, in one step if the buffer supports
+// it, or otherwise by reading them in blocks.
+template <typename Buff>
+void skip_bytes(Buff& buffer, std::size_t bytes) {
+	if constexpr(has_skip_member_v<Buff>) {
+		buffer.skip(bytes);
+	} else {
+		std::array<std::byte, bulk_block_size> scratch;
+		while(bytes > 0 && !deserialization_failed(buffer)) {
+			auto step = std::min(bytes, scratch.size());
+			bulk_read(buffer, scratch.data(), step);
+			bytes -= step;
+		}
+	}
+}
+// Skips count elements that have the fixed serialized size elem_size.
+template <typename Buff>
+void skip_elements(Buff& buffer, std::size_t count, std::size_t elem_size) {
+	if(elem_size != 0 && count > std::numeric_limits<std::size_t>::max() / elem_size) {
+		report_data_error(buffer, "Container length in serialized data exceeds the addressable size.");
+		return;
+	}
+	skip_bytes(buffer, count * elem_size);
+}
+
+template <typename, typename = std::void_t<>>
+struct has_node_handles : std::false_type {};
+template <typename T>
+struct has_node_handles<T, std::void_t<typename T::node_type, decltype(std::declval<T&>().extract(
+																	  std::declval<T&>().begin()))>>
+		: std::true_type {};
+template <typename, typename = std::void_t<>>
+struct has_mapped_type : std::false_type {};
+template <typename T>
+struct has_mapped_type<T, std::void_t<typename T::mapped_type>> : std::true_type {};
+template <typename, typename = std::void_t<>>
+struct has_range_erase : std::false_type {};
+template <typename T>
+struct has_range_erase<T, std::void_t<decltype(std::declval<T&>().erase(std::declval<T&>().begin(),
+																		 std::declval<T&>().end()))>>
+		: std::true_type {};
+
+template <typename, typename = std::void_t<>>
+struct has_reserve_member : std::false_type {};
+template <typename T>
+struct has_reserve_member<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{}))>> : std::true_type {};
+
+// Reserves storage for count elements in the container, if it supports that. The data of each element take up at
+// least a certain number of bytes, therefore the reservation is capped at what the data remaining in the buffer could
+// possibly hold, so that a bogus count can't cause a huge allocation. Without knowing the remaining data, no storage
+// is reserved.
+template <typename C, typename Buff>
+void reserve_elements(Buff& buffer, C& container, std::size_t count) {
+	constexpr auto min_element_size = min_size_helper<std::remove_cv_t<typename C::value_type>>::value();
+	if constexpr(has_reserve_member<C>::value && has_available_bytes_member_v<Buff> && min_element_size > 0) {
+		container.reserve(std::min(count, buffer.available_bytes() / min_element_size));
+	} else {
+		static_cast<void>(buffer);
+		static_cast<void>(container);
+		static_cast<void>(count);
+	}
+}
+
+// Refills a sequence container with count elements, deserializing into the existing elements first, so that their
+// own storage is reused, then dropping surplus elements or appending missing ones.
+template <typename C, typename Buff>
+void refill_sequence(Buff& buffer, C& container, std::size_t count) {
+	auto it = container.begin();
+	std::size_t i = 0;
+	for(; i < count && it != container.end() && !deserialization_failed(buffer); ++i, ++it) {
+		structocol::deserialize_into(buffer, *it);
+	}
+	container.erase(it, container.end());
+	for(; i < count && !deserialization_failed(buffer); ++i) {
+		container.insert(container.end(), structocol::deserialize<typename C::value_type>(buffer));
+	}
+}
+
+// Refills an associative container with count elements, reusing the nodes (and the storage of their keys and values)
+// of the previous elements via node handles.
+template <typename C, typename Buff>
+void refill_nodes(Buff& buffer, C& container, std::size_t count) {
+	C old_nodes = std::move(container);
+	container.clear();
+	for(std::size_t i = 0; i < count && !deserialization_failed(buffer); ++i) {
+		if(old_nodes.empty()) {
+			container.insert(container.end(), structocol::deserialize<typename C::value_type>(buffer));
+			continue;
+		}
+		auto node = old_nodes.extract(old_nodes.begin());
+		if constexpr(has_mapped_type<C>::value) {
+			structocol::deserialize_into(buffer, node.key());
+			structocol::deserialize_into(buffer, node.mapped());
+		} else {
+			structocol::deserialize_into(buffer, node.value());
+		}
+		container.insert(container.end(), std::move(node));
+	}
+}
+
+} // namespace detail
+
+template <typename T>
+struct dynamic_container_serializer {
+	template <typename Buff>
+	static void serialize(Buff& buffer, const T& val) {
+		structocol::varint_serializer::serialize(buffer, val.size());
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			detail::bulk_write(buffer, val.data(), val.size());
+		} else {
+			for(const auto& elem : val) {
+				structocol::serialize(buffer, elem);
+			}
+		}
+	}
+	template <typename Buff>
+	static T deserialize(Buff& buffer) {
+		auto val = detail::make_empty_container<T>(buffer);
+		auto size = structocol::varint_serializer::deserialize(buffer);
+		detail::container_scope scope(buffer, size, sizeof(typename T::value_type));
+		if(!scope.admitted()) return val;
+		detail::reserve_elements(buffer, val, size);
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			detail::bulk_read_append(buffer, val, size);
+		} else {
+			for(std::uint64_t i = 0; i < size && !detail::deserialization_failed(buffer); ++i) {
+				val.insert(val.end(), structocol::deserialize<typename T::value_type>(buffer));
+			}
+		}
+		return val;
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, T& val) {
+		auto size = structocol::varint_serializer::deserialize(buffer);
+		detail::container_scope scope(buffer, size, sizeof(typename T::value_type));
+		if(!scope.admitted()) {
+			val.clear();
+			return;
+		}
+		detail::reserve_elements(buffer, val, size);
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			val.clear();
+			detail::bulk_read_append(buffer, val, size);
+		} else if constexpr(detail::has_node_handles<T>::value) {
+			detail::refill_nodes(buffer, val, size);
+		} else if constexpr(detail::has_range_erase<T>::value &&
+							 std::is_same_v<decltype(*val.begin()), typename T::value_type&>) {
+			// Excludes proxy references like those of std::vector<bool>.
+			detail::refill_sequence(buffer, val, size);
+		} else {
+			val.clear();
+			for(std::uint64_t i = 0; i < size && !detail::deserialization_failed(buffer); ++i) {
+				val.insert(val.end(), structocol::deserialize<typename T::value_type>(buffer));
+			}
+		}
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		using elem_type = typename T::value_type;
+		auto size = structocol::varint_serializer::deserialize(buffer);
+		if constexpr(detail::has_fixed_size_in_format_v<elem_type, Buff>) {
+			detail::skip_elements(buffer, size, structocol::serialized_size<elem_type>());
+		} else {
+			for(std::uint64_t i = 0; i < size && !detail::deserialization_failed(buffer); ++i) {
+				structocol::skip<elem_type>(buffer);
+			}
+		}
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		using elem_type = typename T::value_type;
+		auto size = structocol::varint_serializer::deserialize(buffer);
+		if constexpr(detail::is_always_valid<elem_type, detail::buffer_format_t<Buff>>()) {
+			detail::skip_elements(buffer, size, structocol::serialized_size<elem_type>());
+		} else {
+			for(std::uint64_t i = 0; i < size && !detail::deserialization_failed(buffer); ++i) {
+				structocol::validate<elem_type>(buffer);
+			}
+		}
+	}
+	static std::size_t size(const T& val) {
+		if constexpr(has_fixed_serialized_size_v<typename T::value_type>) {
+			return structocol::varint_serializer::size(val.size()) +
+				   val.size() * structocol::serialized_size<typename T::value_type>();
+		} else {
+			return std::accumulate(val.begin(), val.end(), structocol::varint_serializer::size(val.size()),
+								   [](std::size_t s, const auto& e) { return s + structocol::serialized_size(e); });
+		}
+	}
+};
+
+template <typename... T>
 struct tuple_serializer {
 	template <typename Buff>
 	static void serialize(Buff& buffer, const std::tuple<T...>& val) {
@@ -311,26 +1072,31 @@ struct tuple_serializer {
 	static std::tuple<T...> deserialize(Buff& buffer) {
 		return deserialize_impl(buffer, std::make_index_sequence<sizeof...(T)>{});
 	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, std::tuple<T...>& val) {
+		std::apply([&buffer](auto&... elems) { (structocol::deserialize_into(buffer, elems), ...); }, val);
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		(structocol::skip<T>(buffer), ...);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		(structocol::validate<T>(buffer), ...);
+	}
 	static constexpr std::size_t size() {
 		return (structocol::serialized_size<T>() + ...);
 	}
-	static constexpr std::size_t size(const std::tuple<T...>&) {
-		return size();
+	static std::size_t size(const std::tuple<T...>& val) {
+		return std::apply([](const auto&... elems) { return (structocol::serialized_size(elems) + ... + 0); }, val);
 	}
 
 private:
 	template <typename Buff, std::size_t... indseq>
 	static std::tuple<T...> deserialize_impl(Buff& buffer, std::index_sequence<indseq...>) {
-		// Can't simply be this due to sequencing rules:
-		// return T{deserialize<boost::pfr::tuple_element_t<indseq, T>>(buffer)...};
-		std::tuple<std::optional<T>...> elements;
-		// Fold over comma is correctly sequenced left to right:
-		(deserialize_element<T, indseq>(buffer, elements), ...);
-		return std::tuple(std::move(*std::get<indseq>(elements))...);
-	}
-	template <typename ElemT, std::size_t index, typename Buff, typename Tup>
-	static void deserialize_element(Buff& buffer, Tup& tup) {
-		std::get<index>(tup) = structocol::deserialize<ElemT>(buffer);
+		// The initializers of a braced init list are evaluated left to right, unlike function arguments.
+		// The constructor of std::tuple binds them by reference, so each element is moved once into place.
+		return std::tuple<T...>{structocol::deserialize<std::remove_const_t<T>>(buffer)...};
 	}
 };
 
@@ -343,14 +1109,31 @@ struct pair_serializer {
 	}
 	template <typename Buff>
 	static std::pair<FT, ST> deserialize(Buff& buffer) {
-		auto first = structocol::deserialize<FT>(buffer);
-		return std::pair(std::move(first), structocol::deserialize<ST>(buffer));
+		// Braced init list for left to right evaluation. The members are deserialized as non-const values, so that they
+		// can be moved into the pair, e.g. for the const keys in the value_type of maps.
+		return std::pair<FT, ST>{structocol::deserialize<std::remove_const_t<FT>>(buffer),
+								 structocol::deserialize<std::remove_const_t<ST>>(buffer)};
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, std::pair<FT, ST>& val) {
+		structocol::deserialize_into(buffer, val.first);
+		structocol::deserialize_into(buffer, val.second);
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		structocol::skip<FT>(buffer);
+		structocol::skip<ST>(buffer);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		structocol::validate<FT>(buffer);
+		structocol::validate<ST>(buffer);
 	}
 	static constexpr std::size_t size() {
 		return structocol::serialized_size<FT>() + structocol::serialized_size<ST>();
 	}
-	static constexpr std::size_t size(const std::pair<FT, ST>&) {
-		return size();
+	static std::size_t size(const std::pair<FT, ST>& val) {
+		return structocol::serialized_size(val.first) + structocol::serialized_size(val.second);
 	}
 };
 
@@ -365,8 +1148,32 @@ struct variant_serializer {
 	static std::variant<T...> deserialize(Buff& buffer) {
 		auto index = structocol::deserialize<index_type>(buffer);
 		deserialze_impl_ptr<Buff> impl_table[] = {make_deserialize_impl<Buff, T>()...};
+		if(index >= sizeof...(T)) {
+			detail::report_data_error(buffer, "Invalid variant index in serialized data.");
+			index = 0;
+		}
 		return impl_table[index](buffer);
 	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, std::variant<T...>& val) {
+		auto index = structocol::deserialize<index_type>(buffer);
+		if(index >= sizeof...(T)) {
+			detail::report_data_error(buffer, "Invalid variant index in serialized data.");
+			return;
+		}
+		constexpr auto impl_table = make_deserialize_into_impls<Buff>(std::index_sequence_for<T...>{});
+		impl_table[index](buffer, val);
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		constexpr std::array<void (*)(Buff&), sizeof...(T)> impl_table = {&structocol::skip<T, Buff>...};
+		skip_or_validate_impl(buffer, impl_table);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		constexpr std::array<void (*)(Buff&), sizeof...(T)> impl_table = {&structocol::validate<T, Buff>...};
+		skip_or_validate_impl(buffer, impl_table);
+	}
 	static std::size_t size(const std::variant<T...>& val) {
 		return structocol::serialized_size(index_type(val.index())) +
 			   std::visit([](const auto& v) { return structocol::serialized_size(v); }, val);
@@ -382,6 +1189,30 @@ private:
 			return structocol::deserialize<Content>(buffer);
 		};
 	}
+	template <typename Buff>
+	static void skip_or_validate_impl(Buff& buffer, const std::array<void (*)(Buff&), sizeof...(T)>& impl_table) {
+		auto index = structocol::deserialize<index_type>(buffer);
+		if(index >= sizeof...(T)) {
+			detail::report_data_error(buffer, "Invalid variant index in serialized data.");
+			return;
+		}
+		impl_table[index](buffer);
+	}
+	// Deserializes into the active alternative if it is the serialized one, and otherwise replaces it.
+	template <typename Buff, std::size_t... indseq>
+	static constexpr auto make_deserialize_into_impls(std::index_sequence<indseq...>) {
+		return std::array<void (*)(Buff&, std::variant<T...>&), sizeof...(T)>{
+				&deserialize_into_alternative<Buff, indseq>...};
+	}
+	template <typename Buff, std::size_t index>
+	static void deserialize_into_alternative(Buff& buffer, std::variant<T...>& val) {
+		if(auto* content = std::get_if<index>(&val)) {
+			structocol::deserialize_into(buffer, *content);
+		} else {
+			val.template emplace<index>(
+					structocol::deserialize<std::variant_alternative_t<index, std::variant<T...>>>(buffer));
+		}
+	}
 };
 
 template <typename T>
@@ -402,6 +1233,25 @@ struct optional_serializer {
 			return std::nullopt;
 		}
 	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, std::optional<T>& val) {
+		auto has_val = structocol::deserialize<bool>(buffer);
+		if(!has_val) {
+			val.reset();
+		} else if(val.has_value()) {
+			structocol::deserialize_into(buffer, *val);
+		} else {
+			val.emplace(structocol::deserialize<T>(buffer));
+		}
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		if(structocol::deserialize<bool>(buffer)) structocol::skip<T>(buffer);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		if(structocol::deserialize<bool>(buffer)) structocol::validate<T>(buffer);
+	}
 	static std::size_t size(const std::optional<T>& val) {
 		auto s = structocol::serialized_size(val.has_value());
 		if(val.has_value()) {
@@ -411,6 +1261,44 @@ struct optional_serializer {
 	}
 };
 
+// Serializes views of contiguous single-byte element sequences in the same format as the corresponding dynamic
+// containers (e.g. std::string_view like std::string). Deserializing them doesn't copy the data, but borrows them from
+// the storage of the buffer, which requires a buffer providing read_view(), like vector_buffer. Thus, the deserialized
+// view is only valid as long as the viewed data remain in the buffer, see vector_buffer::read_view().
+template <typename T>
+struct borrowed_view_serializer {
+	using element_type = std::remove_const_t<typename T::value_type>;
+	static_assert(sizeof(element_type) == 1, "Only views of single-byte elements can be borrowed from buffers.");
+
+	template <typename Buff>
+	static void serialize(Buff& buffer, const T& val) {
+		structocol::varint_serializer::serialize(buffer, val.size());
+		detail::bulk_write(buffer, val.data(), val.size());
+	}
+	template <typename Buff>
+	static T deserialize(Buff& buffer) {
+		static_assert(has_read_view_member_v<Buff>,
+					  "Deserializing borrowed views requires a buffer that provides its contiguous storage through "
+					  "read_view(), e.g. vector_buffer.");
+		auto size = structocol::varint_serializer::deserialize(buffer);
+		auto data = buffer.read_view(size);
+		// The size of the returned view is used to get an empty view, if a buffer recording errors couldn't provide the
+		// requested data.
+		return T(reinterpret_cast<const element_type*>(data.data()), data.size());
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		detail::skip_bytes(buffer, structocol::varint_serializer::deserialize(buffer));
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		skip(buffer);
+	}
+	static std::size_t size(const T& val) {
+		return structocol::varint_serializer::size(val.size()) + val.size();
+	}
+};
+
 namespace detail {
 template <typename T>
 struct array_helper {};
@@ -432,32 +1320,160 @@ template <typename T>
 struct array_serializer {
 	template <typename Buff>
 	static void serialize(Buff& buffer, const T& val) {
-		for(const auto& e : val) {
-			structocol::serialize(buffer, e);
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			detail::bulk_write(buffer, std::data(val), std::size(val));
+		} else {
+			for(const auto& e : val) {
+				structocol::serialize(buffer, e);
+			}
 		}
 	}
 	template <typename Buff>
 	static T deserialize(Buff& buffer) {
-		return deserialize_impl(buffer, std::make_index_sequence<detail::array_helper<T>::size>{});
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			T val;
+			detail::bulk_read(buffer, std::data(val), detail::array_helper<T>::size);
+			return val;
+		} else {
+			return deserialize_impl(buffer, std::make_index_sequence<detail::array_helper<T>::size>{});
+		}
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, T& val) {
+		if constexpr(detail::is_bulk_container<T, detail::buffer_format_t<Buff>>()) {
+			detail::bulk_read(buffer, std::data(val), std::size(val));
+		} else {
+			for(auto& e : val) {
+				structocol::deserialize_into(buffer, e);
+			}
+		}
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		using elem_type = typename detail::array_helper<T>::type;
+		for(std::size_t i = 0; i < detail::array_helper<T>::size && !detail::deserialization_failed(buffer); ++i) {
+			structocol::skip<elem_type>(buffer);
+		}
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		using elem_type = typename detail::array_helper<T>::type;
+		if constexpr(detail::is_always_valid<elem_type, detail::buffer_format_t<Buff>>()) {
+			detail::skip_bytes(buffer, size());
+		} else {
+			for(std::size_t i = 0; i < detail::array_helper<T>::size && !detail::deserialization_failed(buffer); ++i) {
+				structocol::validate<elem_type>(buffer);
+			}
+		}
 	}
-	constexpr static std::size_t size(const T& val) {
-		return std::size(val);
+	static std::size_t size(const T& val) {
+		using elem_type = typename detail::array_helper<T>::type;
+		if constexpr(has_fixed_serialized_size_v<elem_type>) {
+			return size();
+		} else {
+			return std::accumulate(std::begin(val), std::end(val), std::size_t{0},
+								   [](std::size_t s, const auto& e) { return s + structocol::serialized_size(e); });
+		}
 	}
 	constexpr static std::size_t size() {
-		return detail::array_helper<T>::size;
+		return detail::array_helper<T>::size * structocol::serialized_size<typename detail::array_helper<T>::type>();
 	}
 
 private:
 	template <typename Buff, std::size_t... indseq>
 	static T deserialize_impl(Buff& buffer, std::index_sequence<indseq...>) {
-		std::array<std::optional<typename detail::array_helper<T>::type>, detail::array_helper<T>::size> elements;
-		for(auto& e : elements) {
-			e = structocol::deserialize<typename detail::array_helper<T>::type>(buffer);
-		}
-		return T{std::move(*std::get<indseq>(elements))...};
+		// Aggregate initialization from the prvalues constructs the elements directly in place, in left to right
+		// order, as guaranteed for braced init lists.
+		return T{deserialize_element<indseq>(buffer)...};
+	}
+	template <std::size_t, typename Buff>
+	static typename detail::array_helper<T>::type deserialize_element(Buff& buffer) {
+		return structocol::deserialize<typename detail::array_helper<T>::type>(buffer);
 	}
 };
 
+namespace detail {
+
+// The bits of std::bitset and std::vector<bool> are serialized with the lowest indices first, each byte beginning with
+// its most significant bit. They are packed and unpacked in 64-bit words, in which bit i holds index i.
+
+constexpr std::size_t bits_to_bytes(std::size_t bits) noexcept {
+	return bits / 8 + ((bits % 8 != 0) ? 1 : 0);
+}
+
+constexpr std::uint64_t reverse_bits_in_bytes(std::uint64_t word) noexcept {
+	word = ((word >> 1) & 0x5555'5555'5555'5555u) | ((word & 0x5555'5555'5555'5555u) << 1);
+	word = ((word >> 2) & 0x3333'3333'3333'3333u) | ((word & 0x3333'3333'3333'3333u) << 2);
+	return ((word >> 4) & 0x0f0f'0f0f'0f0f'0f0fu) | ((word & 0x0f0f'0f0f'0f0f'0f0fu) << 4);
+}
+
+// Stores the first bytes (at most 8) of the serialized form of word at dst.
+inline void store_bit_word(std::uint64_t word, std::uint8_t* dst, std::size_t bytes) noexcept {
+	word = reverse_bits_in_bytes(word);
+	if constexpr(std::endian::native == std::endian::big) word = byteswap(word);
+	std::memcpy(dst, &word, bytes);
+}
+// Loads a word from the given number of serialized bytes (at most 8) at src.
+inline std::uint64_t load_bit_word(const std::uint8_t* src, std::size_t bytes) noexcept {
+	std::uint64_t word = 0;
+	std::memcpy(&word, src, bytes);
+	if constexpr(std::endian::native == std::endian::big) word = byteswap(word);
+	return reverse_bits_in_bytes(word);
+}
+
+template <std::size_t N>
+constexpr std::size_t bitset_words = (N + 63) / 64;
+
+// Checks at compile time, whether the object representation of std::bitset<N> is an array of words holding the bits
+// from the lowest index on, as in the common standard library implementations. If so, the words are accessed directly,
+// otherwise they are extracted using the (slower) shift operators.
+template <std::size_t N>
+constexpr bool bitset_has_word_layout() {
+	if constexpr(N == 0 || !std::is_trivially_copyable_v<std::bitset<N>> ||
+				 sizeof(std::bitset<N>) != bitset_words<N> * sizeof(std::uint64_t)) {
+		return false;
+	} else {
+		constexpr std::uint64_t pattern = 0x0123'4567'89ab'cdefu;
+		constexpr std::uint64_t expected = N >= 64 ? pattern : pattern & ((std::uint64_t(1) << (N % 64)) - 1);
+		return std::bit_cast<std::array<std::uint64_t, bitset_words<N>>>(std::bitset<N>(pattern))[0] == expected;
+	}
+}
+
+template <std::size_t N>
+std::array<std::uint64_t, bitset_words<N>> bitset_to_words(const std::bitset<N>& bits) {
+	if constexpr(bitset_has_word_layout<N>()) {
+		return std::bit_cast<std::array<std::uint64_t, bitset_words<N>>>(bits);
+	} else {
+		std::array<std::uint64_t, bitset_words<N>> words;
+		const std::bitset<N> low_word(~std::uint64_t(0));
+		auto rest = bits;
+		for(auto& word : words) {
+			word = (rest & low_word).to_ullong();
+			rest >>= 64;
+		}
+		return words;
+	}
+}
+// Bits beyond N in the last word are ignored.
+template <std::size_t N>
+std::bitset<N> bitset_from_words(std::array<std::uint64_t, bitset_words<N>> words) {
+	if constexpr(bitset_has_word_layout<N>()) {
+		if constexpr(N % 64 != 0) {
+			words.back() &= (std::uint64_t(1) << (N % 64)) - 1;
+		}
+		return std::bit_cast<std::bitset<N>>(words);
+	} else {
+		std::bitset<N> res;
+		for(auto it = words.rbegin(); it != words.rend(); ++it) {
+			res <<= 64;
+			res |= std::bitset<N>(*it);
+		}
+		return res;
+	}
+}
+
+} // namespace detail
+
 template <typename T>
 struct static_bitset_serializer {
 	template <typename Buff>
@@ -466,11 +1482,10 @@ struct static_bitset_serializer {
 		if constexpr(bits > 0) {
 			constexpr auto bytes = size();
 			std::array<std::uint8_t, bytes> byte_arr;
-			for(std::size_t byte = 0; byte < bytes; ++byte) {
-				byte_arr[byte] = 0;
-				for(std::size_t bit = 0; bit < 8 && byte * 8 + bit < bits; ++bit) {
-					byte_arr[byte] |= val.test(byte * 8 + bit) ? (1 << (7 - bit)) : 0;
-				}
+			auto words = detail::bitset_to_words(val);
+			for(std::size_t word = 0; word < words.size(); ++word) {
+				auto word_bytes = std::min<std::size_t>(8, bytes - word * 8);
+				detail::store_bit_word(words[word], byte_arr.data() + word * 8, word_bytes);
 			}
 			structocol::serialize(buffer, byte_arr);
 		} else {
@@ -480,26 +1495,30 @@ struct static_bitset_serializer {
 	}
 	template <typename Buff>
 	static T deserialize(Buff& buffer) {
-		T res;
 		constexpr auto bits = bit_size();
 		if constexpr(bits > 0) {
 			constexpr auto bytes = size();
 			auto byte_arr = structocol::deserialize<std::array<std::uint8_t, bytes>>(buffer);
-			for(std::size_t byte = 0; byte < bytes; ++byte) {
-				for(std::size_t bit = 0; bit < 8 && byte * 8 + bit < bits; ++bit) {
-					res.set(byte * 8 + bit, (byte_arr[byte] & (1 << (7 - bit))) != 0);
-				}
+			std::array<std::uint64_t, detail::bitset_words<bits>> words;
+			for(std::size_t word = 0; word < words.size(); ++word) {
+				auto word_bytes = std::min<std::size_t>(8, bytes - word * 8);
+				words[word] = detail::load_bit_word(byte_arr.data() + word * 8, word_bytes);
 			}
+			return detail::bitset_from_words<bits>(words);
 		} else {
 			static_cast<void>(buffer);
+			return T();
 		}
-		return res;
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		detail::skip_bytes(buffer, size());
 	}
 	constexpr static std::size_t size(const T&) noexcept {
 		return size();
 	}
 	constexpr static std::size_t size() noexcept {
-		return bit_size() / 8 + ((bit_size() % 8 != 0) ? 1 : 0);
+		return detail::bits_to_bytes(bit_size());
 	}
 
 private:
@@ -508,6 +1527,84 @@ private:
 	}
 };
 
+// Serializes std::vector<bool> as its number of elements (as varint_t) followed by the elements packed like the bits
+// of a std::bitset.
+template <typename T>
+struct bool_vector_serializer {
+	template <typename Buff>
+	static void serialize(Buff& buffer, const T& val) {
+		varint_serializer::serialize(buffer, val.size());
+		std::array<std::uint8_t, detail::bulk_block_size> block;
+		auto it = val.begin();
+		for(std::size_t remaining = val.size(); remaining > 0;) {
+			auto bits = std::min(remaining, block.size() * 8);
+			auto bytes = detail::bits_to_bytes(bits);
+			for(std::size_t offset = 0; offset < bytes; offset += 8) {
+				auto word_bits = std::min<std::size_t>(64, bits - offset * 8);
+				std::uint64_t word = 0;
+				for(std::size_t bit = 0; bit < word_bits; ++bit) {
+					word |= std::uint64_t(it[bit]) << bit;
+				}
+				it += word_bits;
+				detail::store_bit_word(word, block.data() + offset, std::min<std::size_t>(8, bytes - offset));
+			}
+			detail::bulk_write(buffer, block.data(), bytes);
+			remaining -= bits;
+		}
+	}
+	template <typename Buff>
+	static T deserialize(Buff& buffer) {
+		auto val = detail::make_empty_container<T>(buffer);
+		deserialize_into(buffer, val);
+		return val;
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, T& val) {
+		std::size_t count = varint_serializer::deserialize(buffer);
+		val.clear();
+		detail::container_scope scope(buffer, count, sizeof(bool));
+		if(!scope.admitted()) return;
+		if constexpr(has_available_bytes_member_v<Buff>) {
+			val.reserve(std::min(count, buffer.available_bytes() * 8));
+		}
+		// The elements are appended block-wise as the data arrive, so that a bogus count can't cause a huge allocation.
+		std::array<std::uint8_t, detail::bulk_block_size> block;
+		while(count > 0 && !detail::deserialization_failed(buffer)) {
+			auto bits = std::min(count, block.size() * 8);
+			auto bytes = detail::bits_to_bytes(bits);
+			detail::bulk_read(buffer, block.data(), bytes);
+			if(detail::deserialization_failed(buffer)) return;
+			auto old_size = val.size();
+			val.resize(old_size + bits);
+			// The new elements are false, only the set bits need to be assigned.
+			auto block_begin = val.begin() + old_size;
+			for(std::size_t offset = 0; offset < bytes; offset += 8) {
+				auto word_bits = std::min<std::size_t>(64, bits - offset * 8);
+				auto word = detail::load_bit_word(block.data() + offset, std::min<std::size_t>(8, bytes - offset));
+				if(word_bits < 64) word &= (std::uint64_t(1) << word_bits) - 1;
+				auto word_begin = block_begin + offset * 8;
+				for(; word != 0; word &= word - 1) {
+					word_begin[std::countr_zero(word)] = true;
+				}
+			}
+			count -= bits;
+		}
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		std::size_t count = varint_serializer::deserialize(buffer);
+		if(detail::deserialization_failed(buffer)) return;
+		detail::skip_bytes(buffer, detail::bits_to_bytes(count));
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		skip(buffer);
+	}
+	static std::size_t size(const T& val) {
+		return varint_serializer::size(val.size()) + detail::bits_to_bytes(val.size());
+	}
+};
+
 template <auto... values>
 struct magic_number_serializer {
 	template <typename Buff>
@@ -530,61 +1627,205 @@ private:
 	template <typename Buff, typename Value>
 	static void deserialize_and_check(Buff& buffer, const Value& value) {
 		if(structocol::deserialize<Value>(buffer) != value) {
-			throw deserialization_data_error("Magic number field doesn't have the expected value on deserialization.");
+			detail::report_data_error(buffer, "Magic number field doesn't have the expected value on deserialization.");
 		}
 	}
 };
 
 namespace detail {
-template <typename T, typename Enable = void>
-struct general_serializer {
-	static_assert(dependent_false<T>, "The requested type is not supported for serialization out of the box. If its "
-									  "serialization is desired specialize structocol::serializer<T> for it.");
-};
+// Buffer adapters over a memory block of known size, used to (de)serialize the fields of aggregates with a fixed
+// serialized size with a single read or write on the actual buffer. The block is sized at compile time from the
+// serialized sizes of the fields, therefore they don't need to do bounds checks. They use the format of the actual
+// buffer.
+template <typename Format>
+class fixed_block_writer {
+	std::byte* pos_;
 
-template <typename T>
-struct general_serializer<T, std::enable_if_t<std::is_aggregate_v<T>>> {
-	template <typename Buff>
-	static void serialize(Buff& buffer, const T& val) {
-		if constexpr(boost::pfr::tuple_size_v<T> > 0) {
-			boost::pfr::for_each_field(val, [&buffer](const auto& field) { structocol::serialize(buffer, field); });
-		} else {
-			static_cast<void>(buffer);
-			static_cast<void>(val);
-		}
+public:
+	using format_policy = Format;
+
+	explicit fixed_block_writer(std::byte* block) noexcept : pos_{block} {}
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) noexcept {
+		std::memcpy(pos_, data.data(), bytes);
+		pos_ += bytes;
 	}
-	template <typename Buff>
-	static T deserialize(Buff& buffer) {
-		return deserialize_impl(buffer, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+	void write(std::span<const std::byte> data) noexcept {
+		std::memcpy(pos_, data.data(), data.size());
+		pos_ += data.size();
 	}
-	static constexpr std::size_t size() {
-		return size_impl(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+};
+
+template <typename Format>
+class fixed_block_reader {
+	const std::byte* pos_;
+
+public:
+	using format_policy = Format;
+
+	explicit fixed_block_reader(const std::byte* block) noexcept : pos_{block} {}
+
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() noexcept {
+		std::array<std::byte, bytes> ret;
+		std::memcpy(ret.data(), pos_, bytes);
+		pos_ += bytes;
+		return ret;
+	}
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() noexcept {
+		return read<bytes>();
+	}
+	void read_into(std::span<std::byte> data) noexcept {
+		std::memcpy(data.data(), pos_, data.size());
+		pos_ += data.size();
+	}
+	bool try_read_into(std::span<std::byte> data) noexcept {
+		read_into(data);
+		return true;
+	}
+};
+
+// Forwards errors reported while decoding a block to the buffer it was read from, if that buffer records errors.
+template <typename Buff>
+class error_forwarding_block_reader : public fixed_block_reader<buffer_format_t<Buff>> {
+	Buff& buffer_;
+
+public:
+	error_forwarding_block_reader(const std::byte* block, Buff& buffer) noexcept
+			: fixed_block_reader<buffer_format_t<Buff>>(block), buffer_{buffer} {}
+
+	void report_error(errc e) {
+		buffer_.report_error(e);
+	}
+	bool failed() const noexcept {
+		return buffer_.failed();
+	}
+};
+
+template <typename Buff>
+auto make_fixed_block_reader(const std::byte* block, Buff& buffer) {
+	if constexpr(has_error_reporting_members<Buff>::value) {
+		return error_forwarding_block_reader<Buff>(block, buffer);
+	} else {
+		static_cast<void>(buffer);
+		return fixed_block_reader<buffer_format_t<Buff>>(block);
+	}
+}
+
+template <typename T, typename Enable = void>
+struct general_serializer {
+	static_assert(dependent_false<T>, "The requested type is not supported for serialization out of the box. If its "
+									  "serialization is desired specialize structocol::serializer<T> for it.");
+};
+
+template <typename T>
+struct general_serializer<T, std::enable_if_t<std::is_aggregate_v<T>>> {
+	template <typename Buff>
+	static void serialize(Buff& buffer, const T& val) {
+		if constexpr(is_flat<Buff>()) {
+			// Encode all fields into one block and write it at once.
+			std::array<std::byte, size()> block;
+			fixed_block_writer<buffer_format_t<Buff>> writer(block.data());
+			boost::pfr::for_each_field(val, [&writer](const auto& field) { structocol::serialize(writer, field); });
+			buffer.write(block);
+		} else if constexpr(boost::pfr::tuple_size_v<T> > 0) {
+			boost::pfr::for_each_field(val, [&buffer](const auto& field) { structocol::serialize(buffer, field); });
+		} else {
+			static_cast<void>(buffer);
+			static_cast<void>(val);
+		}
+	}
+	template <typename Buff>
+	static T deserialize(Buff& buffer) {
+		if constexpr(is_flat<Buff>()) {
+			return deserialize_flat_impl(buffer, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+		} else {
+			return deserialize_impl(buffer, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+		}
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, T& val) {
+		if constexpr(is_flat<Buff>()) {
+			// There is no storage to keep in a flat aggregate.
+			val = deserialize(buffer);
+		} else if constexpr(boost::pfr::tuple_size_v<T> > 0) {
+			boost::pfr::for_each_field(val, [&buffer](auto& field) { structocol::deserialize_into(buffer, field); });
+		} else {
+			static_cast<void>(buffer);
+			static_cast<void>(val);
+		}
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		skip_impl(buffer, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		if constexpr(is_flat<Buff>()) {
+			auto block = buffer.template read<size()>();
+			auto reader = make_fixed_block_reader(block.data(), buffer);
+			validate_impl(reader, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+		} else {
+			validate_impl(buffer, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+		}
+	}
+	static constexpr std::size_t size() {
+		return size_impl(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
 	}
 	static std::size_t size(const T& val) {
 		return size_impl(val, std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
 	}
 
 private:
+	// Aggregates of only fixed-size fields are transferred as one block, from which the fields are decoded at offsets
+	// known at compile time.
+	template <typename Buff>
+	static constexpr bool is_flat() {
+		if constexpr(boost::pfr::tuple_size_v<T> > 0) {
+			return has_fixed_size_in_format_v<T, Buff>;
+		} else {
+			return false;
+		}
+	}
 	template <std::size_t... indseq>
 	static constexpr std::size_t size_impl(std::index_sequence<indseq...>) {
 		return (structocol::serialized_size<boost::pfr::tuple_element_t<indseq, T>>() + ... + 0);
 	}
+	template <std::size_t index>
+	static constexpr std::size_t field_offset() {
+		return size_impl(std::make_index_sequence<index>{});
+	}
+	template <typename Buff, std::size_t... indseq>
+	static T deserialize_flat_impl(Buff& buffer, std::index_sequence<indseq...>) {
+		auto block = buffer.template read<size()>();
+		// As each field is decoded from its own offset, the evaluation order of the initializers doesn't matter here.
+		return T{deserialize_flat_field<boost::pfr::tuple_element_t<indseq, T>, indseq>(buffer, block.data())...};
+	}
+	template <typename ElemT, std::size_t index, typename Buff>
+	static ElemT deserialize_flat_field(Buff& buffer, const std::byte* block) {
+		auto reader = make_fixed_block_reader(block + field_offset<index>(), buffer);
+		return structocol::deserialize<ElemT>(reader);
+	}
 	template <std::size_t... indseq>
 	static std::size_t size_impl(const T& val, std::index_sequence<indseq...>) {
 		return (structocol::serialized_size(boost::pfr::get<indseq>(val)) + ... + 0);
 	}
 	template <typename Buff, std::size_t... indseq>
 	static T deserialize_impl(Buff& buffer, std::index_sequence<indseq...>) {
-		// Can't simply be this due to sequencing rules:
-		// return T{deserialize<boost::pfr::tuple_element_t<indseq, T>>(buffer)...};
-		std::tuple<std::optional<boost::pfr::tuple_element_t<indseq, T>>...> elements;
-		// Fold over comma is correctly sequenced left to right:
-		(deserialize_element<boost::pfr::tuple_element_t<indseq, T>, indseq>(buffer, elements), ..., (void)0);
-		return T{std::move(*std::get<indseq>(elements))...};
+		// Aggregate initialization from the prvalues constructs the fields directly in place, in left to right
+		// order, as guaranteed for braced init lists.
+		static_cast<void>(buffer);
+		return T{structocol::deserialize<boost::pfr::tuple_element_t<indseq, T>>(buffer)...};
 	}
-	template <typename ElemT, std::size_t index, typename Buff, typename Tup>
-	static void deserialize_element(Buff& buffer, Tup& tup) {
-		std::get<index>(tup) = structocol::deserialize<ElemT>(buffer);
+	template <typename Buff, std::size_t... indseq>
+	static void skip_impl(Buff& buffer, std::index_sequence<indseq...>) {
+		(structocol::skip<boost::pfr::tuple_element_t<indseq, T>>(buffer), ..., (void)0);
+	}
+	template <typename Buff, std::size_t... indseq>
+	static void validate_impl(Buff& buffer, std::index_sequence<indseq...>) {
+		(structocol::validate<boost::pfr::tuple_element_t<indseq, T>>(buffer), ..., (void)0);
 	}
 };
 
@@ -606,8 +1847,190 @@ struct general_serializer<T, std::enable_if_t<std::is_enum_v<T>>> {
 	}
 };
 
+template <typename T>
+struct presence_field {
+	using value_type = T;
+	static constexpr bool optional = false;
+};
+template <typename T>
+struct presence_field<std::optional<T>> {
+	using value_type = T;
+	static constexpr bool optional = true;
+};
+
+template <typename T, std::size_t... indseq>
+constexpr std::size_t count_optional_fields(std::index_sequence<indseq...>) {
+	return (std::size_t(presence_field<std::remove_cv_t<boost::pfr::tuple_element_t<indseq, T>>>::optional) + ... + 0);
+}
+
 } // namespace detail
 
+// Opt-in serializer for aggregates with many std::optional fields, of which typically only a few are engaged.
+// Instead of a presence byte for each optional field, it writes one bitmap (packed like a std::bitset) with a bit for
+// each optional field in field order, followed by the non-optional fields and the values of the engaged optional fields
+// in field order. It is selected by specializing serializer for the type:
+// template <>
+// struct structocol::serializer<my_update> : structocol::presence_bitmap_serializer<my_update> {};
+template <typename T>
+struct presence_bitmap_serializer {
+	static_assert(std::is_aggregate_v<T> && !std::is_array_v<T>, "presence_bitmap_serializer requires an aggregate.");
+
+	static constexpr std::size_t field_count = boost::pfr::tuple_size_v<T>;
+	// Type information of the field with the given index.
+	template <std::size_t index>
+	using field_info = detail::presence_field<std::remove_cv_t<boost::pfr::tuple_element_t<index, T>>>;
+	// Index of the presence bit of the field with the given index, if it is optional.
+	template <std::size_t index>
+	static constexpr std::size_t bit_index = detail::count_optional_fields<T>(std::make_index_sequence<index>{});
+	using bitmap = std::bitset<bit_index<field_count>>;
+	static_assert(bit_index<field_count> > 0, "presence_bitmap_serializer requires at least one std::optional field.");
+
+	template <typename Buff>
+	static void serialize(Buff& buffer, const T& val) {
+		bitmap presence;
+		std::size_t bit = 0;
+		boost::pfr::for_each_field(val, [&presence, &bit](const auto& field) {
+			if constexpr(field_info_of<decltype(field)>::optional) presence.set(bit++, field.has_value());
+		});
+		structocol::serialize(buffer, presence);
+		boost::pfr::for_each_field(val, [&buffer](const auto& field) {
+			if constexpr(field_info_of<decltype(field)>::optional) {
+				if(field.has_value()) structocol::serialize(buffer, *field);
+			} else {
+				structocol::serialize(buffer, field);
+			}
+		});
+	}
+	template <typename Buff>
+	static T deserialize(Buff& buffer) {
+		auto presence = structocol::deserialize<bitmap>(buffer);
+		return deserialize_impl(buffer, presence, std::make_index_sequence<field_count>{});
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, T& val) {
+		auto presence = structocol::deserialize<bitmap>(buffer);
+		std::size_t bit = 0;
+		boost::pfr::for_each_field(val, [&buffer, &presence, &bit](auto& field) {
+			if constexpr(field_info_of<decltype(field)>::optional) {
+				if(!presence.test(bit++)) {
+					field.reset();
+				} else if(field.has_value()) {
+					structocol::deserialize_into(buffer, *field);
+				} else {
+					field.emplace(structocol::deserialize<typename field_info_of<decltype(field)>::value_type>(buffer));
+				}
+			} else {
+				structocol::deserialize_into(buffer, field);
+			}
+		});
+	}
+	// Consecutive present fields with a fixed serialized size are skipped together.
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		auto presence = structocol::deserialize<bitmap>(buffer);
+		std::size_t pending_bytes = 0;
+		skip_impl(buffer, presence, pending_bytes, std::make_index_sequence<field_count>{});
+		detail::skip_bytes(buffer, pending_bytes);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		auto presence = structocol::deserialize<bitmap>(buffer);
+		validate_impl(buffer, presence, std::make_index_sequence<field_count>{});
+	}
+	static std::size_t size(const T& val) {
+		return size_impl(val, std::make_index_sequence<field_count>{});
+	}
+	// Serialized size of a value with no engaged optional fields, if the non-optional fields have a minimum size.
+	static constexpr std::size_t min_size() {
+		return min_size_impl(std::make_index_sequence<field_count>{});
+	}
+
+private:
+	template <typename Field>
+	using field_info_of = detail::presence_field<std::remove_cvref_t<Field>>;
+
+	template <std::size_t index>
+	static bool is_present(const bitmap& presence) {
+		if constexpr(field_info<index>::optional) {
+			return presence.test(bit_index<index>);
+		} else {
+			static_cast<void>(presence);
+			return true;
+		}
+	}
+	template <typename Buff, std::size_t... indseq>
+	static T deserialize_impl(Buff& buffer, const bitmap& presence, std::index_sequence<indseq...>) {
+		// The fields are deserialized in left to right order, as guaranteed for braced init lists.
+		return T{deserialize_field<indseq>(buffer, presence)...};
+	}
+	template <std::size_t index, typename Buff>
+	static auto deserialize_field(Buff& buffer, const bitmap& presence) {
+		using value_type = typename field_info<index>::value_type;
+		if constexpr(field_info<index>::optional) {
+			if(!presence.test(bit_index<index>)) return std::optional<value_type>();
+			return std::optional<value_type>(structocol::deserialize<value_type>(buffer));
+		} else {
+			static_cast<void>(presence);
+			return structocol::deserialize<value_type>(buffer);
+		}
+	}
+	template <typename Buff, std::size_t... indseq>
+	static void skip_impl(Buff& buffer, const bitmap& presence, std::size_t& pending_bytes,
+						  std::index_sequence<indseq...>) {
+		(skip_field<indseq>(buffer, presence, pending_bytes), ..., (void)0);
+	}
+	template <std::size_t index, typename Buff>
+	static void skip_field(Buff& buffer, const bitmap& presence, std::size_t& pending_bytes) {
+		using value_type = typename field_info<index>::value_type;
+		if(!is_present<index>(presence)) return;
+		if constexpr(detail::has_fixed_size_in_format_v<value_type, Buff>) {
+			pending_bytes += serialized_size<value_type>();
+		} else {
+			detail::skip_bytes(buffer, pending_bytes);
+			pending_bytes = 0;
+			structocol::skip<value_type>(buffer);
+		}
+	}
+	template <typename Buff, std::size_t... indseq>
+	static void validate_impl(Buff& buffer, const bitmap& presence, std::index_sequence<indseq...>) {
+		((is_present<indseq>(presence) ? structocol::validate<typename field_info<indseq>::value_type>(buffer)
+										: void()),
+		 ..., (void)0);
+	}
+	template <std::size_t... indseq>
+	static std::size_t size_impl(const T& val, std::index_sequence<indseq...>) {
+		return serialized_size<bitmap>() + (field_size<indseq>(boost::pfr::get<indseq>(val)) + ... + 0);
+	}
+	template <std::size_t index, typename Field>
+	static std::size_t field_size(const Field& field) {
+		using value_type = typename field_info<index>::value_type;
+		if constexpr(field_info<index>::optional) {
+			if(!field.has_value()) return 0;
+			if constexpr(has_fixed_serialized_size_v<value_type>) {
+				return serialized_size<value_type>();
+			} else {
+				return structocol::serialized_size(*field);
+			}
+		} else if constexpr(has_fixed_serialized_size_v<value_type>) {
+			return serialized_size<value_type>();
+		} else {
+			return structocol::serialized_size(field);
+		}
+	}
+	template <std::size_t index>
+	static constexpr std::size_t field_min_size() {
+		if constexpr(field_info<index>::optional) {
+			return 0;
+		} else {
+			return detail::min_size_helper<typename field_info<index>::value_type>::value();
+		}
+	}
+	template <std::size_t... indseq>
+	static constexpr std::size_t min_size_impl(std::index_sequence<indseq...>) {
+		return serialized_size<bitmap>() + (field_min_size<indseq>() + ... + 0);
+	}
+};
+
 template <typename T>
 struct serializer : detail::general_serializer<T> {};
 
@@ -630,29 +2053,31 @@ struct serializer<char8_t> : single_byte_serializer<char8_t> {};
 #endif
 template <>
 struct serializer<bool> : single_byte_serializer<bool> {};
+template <>
+struct serializer<std::byte> : single_byte_serializer<std::byte> {};
 
 /// Note: Multi-byte integers are serialized in big endian format.
 
 template <>
-struct serializer<std::uint16_t> : integral_big_endian_serializer<std::uint16_t> {};
+struct serializer<std::uint16_t> : integral_serializer<std::uint16_t> {};
 template <>
-struct serializer<std::int16_t> : integral_big_endian_serializer<std::int16_t> {};
+struct serializer<std::int16_t> : integral_serializer<std::int16_t> {};
 template <>
-struct serializer<std::uint32_t> : integral_big_endian_serializer<std::uint32_t> {};
+struct serializer<std::uint32_t> : integral_serializer<std::uint32_t> {};
 template <>
-struct serializer<std::int32_t> : integral_big_endian_serializer<std::int32_t> {};
+struct serializer<std::int32_t> : integral_serializer<std::int32_t> {};
 template <>
-struct serializer<std::uint64_t> : integral_big_endian_serializer<std::uint64_t> {};
+struct serializer<std::uint64_t> : integral_serializer<std::uint64_t> {};
 template <>
-struct serializer<std::int64_t> : integral_big_endian_serializer<std::int64_t> {};
+struct serializer<std::int64_t> : integral_serializer<std::int64_t> {};
 static_assert(sizeof(char16_t) * CHAR_BIT == 16, "(De)Serialization is only supported for architectures "
 												 "where char16_t is exactly 16 bits big (not larger).");
 template <>
-struct serializer<char16_t> : integral_big_endian_serializer<char16_t> {};
+struct serializer<char16_t> : integral_serializer<char16_t> {};
 static_assert(sizeof(char32_t) * CHAR_BIT == 32, "(De)Serialization is only supported for architectures "
 												 "where char32_t is exactly 32 bits big (not larger).");
 template <>
-struct serializer<char32_t> : integral_big_endian_serializer<char32_t> {};
+struct serializer<char32_t> : integral_serializer<char32_t> {};
 
 template <>
 struct serializer<float> : floating_point_serializer<float> {};
@@ -691,25 +2116,30 @@ struct serializer<DC> : dynamic_container_serializer<DC> {};
 
 #else
 
-template <typename T>
-struct serializer<std::vector<T>> : dynamic_container_serializer<std::vector<T>> {};
-template <typename T>
-struct serializer<std::list<T>> : dynamic_container_serializer<std::list<T>> {};
-template <typename T>
-struct serializer<std::deque<T>> : dynamic_container_serializer<std::deque<T>> {};
-template <typename K, typename V>
-struct serializer<std::map<K, V>> : dynamic_container_serializer<std::map<K, V>> {};
-template <typename T>
-struct serializer<std::set<T>> : dynamic_container_serializer<std::set<T>> {};
-template <typename K, typename V>
-struct serializer<std::multimap<K, V>> : dynamic_container_serializer<std::multimap<K, V>> {};
-template <typename T>
-struct serializer<std::multiset<T>> : dynamic_container_serializer<std::multiset<T>> {};
+template <typename T, typename Alloc>
+struct serializer<std::vector<T, Alloc>> : dynamic_container_serializer<std::vector<T, Alloc>> {};
+template <typename T, typename Alloc>
+struct serializer<std::list<T, Alloc>> : dynamic_container_serializer<std::list<T, Alloc>> {};
+template <typename T, typename Alloc>
+struct serializer<std::deque<T, Alloc>> : dynamic_container_serializer<std::deque<T, Alloc>> {};
+template <typename K, typename V, typename Comp, typename Alloc>
+struct serializer<std::map<K, V, Comp, Alloc>> : dynamic_container_serializer<std::map<K, V, Comp, Alloc>> {};
+template <typename T, typename Comp, typename Alloc>
+struct serializer<std::set<T, Comp, Alloc>> : dynamic_container_serializer<std::set<T, Comp, Alloc>> {};
+template <typename K, typename V, typename Comp, typename Alloc>
+struct serializer<std::multimap<K, V, Comp, Alloc>>
+		: dynamic_container_serializer<std::multimap<K, V, Comp, Alloc>> {};
+template <typename T, typename Comp, typename Alloc>
+struct serializer<std::multiset<T, Comp, Alloc>> : dynamic_container_serializer<std::multiset<T, Comp, Alloc>> {};
 
 #endif
 
-template <typename T>
-struct serializer<std::basic_string<T>> : dynamic_container_serializer<std::basic_string<T>> {};
+template <typename Alloc>
+struct serializer<std::vector<bool, Alloc>> : bool_vector_serializer<std::vector<bool, Alloc>> {};
+
+template <typename T, typename Alloc>
+struct serializer<std::basic_string<T, std::char_traits<T>, Alloc>>
+		: dynamic_container_serializer<std::basic_string<T, std::char_traits<T>, Alloc>> {};
 template <>
 struct serializer<std::wstring> {
 	// Serializing wstring is not supported because its encoding is too implementation-defined.
@@ -719,6 +2149,13 @@ struct serializer<std::wstring> {
 	static std::wstring deserialize(Buff& buffer) = delete;
 };
 
+template <>
+struct serializer<std::string_view> : borrowed_view_serializer<std::string_view> {};
+template <>
+struct serializer<std::span<const std::byte>> : borrowed_view_serializer<std::span<const std::byte>> {};
+template <>
+struct serializer<std::span<const std::uint8_t>> : borrowed_view_serializer<std::span<const std::uint8_t>> {};
+
 template <typename FT, typename ST>
 struct serializer<std::pair<FT, ST>> : pair_serializer<FT, ST> {};
 template <typename... T>
@@ -731,6 +2168,8 @@ struct serializer<std::optional<T>> : optional_serializer<T> {};
 
 template <>
 struct serializer<varint_t> : varint_serializer {};
+template <>
+struct serializer<signed_varint_t> : signed_varint_serializer {};
 
 template <>
 struct serializer<std::monostate> {
@@ -759,6 +2198,316 @@ struct serializer<std::bitset<N>> : static_bitset_serializer<std::bitset<N>> {};
 template <auto... values>
 struct serializer<magic_number<values...>> : magic_number_serializer<values...> {};
 
+namespace detail {
+template <typename T>
+struct fixed_size_helper {
+	static constexpr bool value() {
+		if constexpr(std::is_base_of_v<single_byte_serializer<T>, serializer<T>> ||
+					 std::is_base_of_v<integral_serializer<T>, serializer<T>> ||
+					 std::is_base_of_v<floating_point_serializer<T>, serializer<T>>) {
+			return true;
+		} else if constexpr(std::is_enum_v<T>) {
+			return std::is_base_of_v<general_serializer<T>, serializer<T>> &&
+				   has_fixed_serialized_size_v<std::underlying_type_t<T>>;
+		} else if constexpr(std::is_aggregate_v<T> && !std::is_array_v<T>) {
+			if constexpr(std::is_base_of_v<general_serializer<T>, serializer<T>>) {
+				return fields_value(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+			} else {
+				return false;
+			}
+		} else {
+			return false;
+		}
+	}
+
+private:
+	template <std::size_t... indseq>
+	static constexpr bool fields_value(std::index_sequence<indseq...>) {
+		return (has_fixed_serialized_size_v<boost::pfr::tuple_element_t<indseq, T>> && ... && true);
+	}
+};
+template <typename... T>
+struct fixed_size_helper<std::tuple<T...>> {
+	static constexpr bool value() {
+		return std::is_base_of_v<tuple_serializer<T...>, serializer<std::tuple<T...>>> &&
+			   (has_fixed_serialized_size_v<T> && ... && true);
+	}
+};
+template <typename FT, typename ST>
+struct fixed_size_helper<std::pair<FT, ST>> {
+	static constexpr bool value() {
+		return std::is_base_of_v<pair_serializer<FT, ST>, serializer<std::pair<FT, ST>>> &&
+			   has_fixed_serialized_size_v<FT> && has_fixed_serialized_size_v<ST>;
+	}
+};
+template <typename T, std::size_t N>
+struct fixed_size_helper<std::array<T, N>> {
+	static constexpr bool value() {
+		return std::is_base_of_v<array_serializer<std::array<T, N>>, serializer<std::array<T, N>>> &&
+			   has_fixed_serialized_size_v<T>;
+	}
+};
+template <typename T, std::size_t N>
+struct fixed_size_helper<T[N]> {
+	static constexpr bool value() {
+		return std::is_base_of_v<array_serializer<T[N]>, serializer<T[N]>> && has_fixed_serialized_size_v<T>;
+	}
+};
+template <std::size_t N>
+struct fixed_size_helper<std::bitset<N>> {
+	static constexpr bool value() {
+		return std::is_base_of_v<static_bitset_serializer<std::bitset<N>>, serializer<std::bitset<N>>>;
+	}
+};
+template <auto... values>
+struct fixed_size_helper<magic_number<values...>> {
+	static constexpr bool value() {
+		return std::is_base_of_v<magic_number_serializer<values...>, serializer<magic_number<values...>>>;
+	}
+};
+template <>
+struct fixed_size_helper<std::monostate> {
+	static constexpr bool value() {
+		return true;
+	}
+};
+
+template <typename T>
+struct min_size_helper {
+	static constexpr std::size_t value() {
+		if constexpr(has_fixed_serialized_size_v<T>) {
+			return serialized_size<T>();
+		} else if constexpr(std::is_base_of_v<varint_serializer, serializer<T>>) {
+			return 1;
+		} else if constexpr(std::is_base_of_v<dynamic_container_serializer<T>, serializer<T>> ||
+							 std::is_base_of_v<borrowed_view_serializer<T>, serializer<T>> ||
+							 std::is_base_of_v<bool_vector_serializer<T>, serializer<T>>) {
+			// Length field
+			return 1;
+		} else if constexpr(std::is_base_of_v<presence_bitmap_serializer<T>, serializer<T>>) {
+			return presence_bitmap_serializer<T>::min_size();
+		} else if constexpr(std::is_base_of_v<array_serializer<T>, serializer<T>>) {
+			return array_helper<T>::size * min_size_helper<std::remove_cv_t<typename array_helper<T>::type>>::value();
+		} else if constexpr(std::is_aggregate_v<T> && !std::is_array_v<T>) {
+			if constexpr(std::is_base_of_v<general_serializer<T>, serializer<T>>) {
+				return fields_value(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+			} else {
+				return 0;
+			}
+		} else {
+			return 0;
+		}
+	}
+
+private:
+	template <std::size_t... indseq>
+	static constexpr std::size_t fields_value(std::index_sequence<indseq...>) {
+		return (min_size_helper<std::remove_cv_t<boost::pfr::tuple_element_t<indseq, T>>>::value() + ... + 0);
+	}
+};
+template <typename... T>
+struct min_size_helper<std::tuple<T...>> {
+	static constexpr std::size_t value() {
+		if constexpr(std::is_base_of_v<tuple_serializer<T...>, serializer<std::tuple<T...>>>) {
+			return (min_size_helper<std::remove_cv_t<T>>::value() + ... + 0);
+		} else {
+			return 0;
+		}
+	}
+};
+template <typename FT, typename ST>
+struct min_size_helper<std::pair<FT, ST>> {
+	static constexpr std::size_t value() {
+		if constexpr(std::is_base_of_v<pair_serializer<FT, ST>, serializer<std::pair<FT, ST>>>) {
+			return min_size_helper<std::remove_cv_t<FT>>::value() + min_size_helper<std::remove_cv_t<ST>>::value();
+		} else {
+			return 0;
+		}
+	}
+};
+template <typename... T>
+struct min_size_helper<std::variant<T...>> {
+	static constexpr std::size_t value() {
+		if constexpr(std::is_base_of_v<variant_serializer<T...>, serializer<std::variant<T...>>>) {
+			return serialized_size<sufficient_uint_t<sizeof...(T)>>();
+		} else {
+			return 0;
+		}
+	}
+};
+template <typename T>
+struct min_size_helper<std::optional<T>> {
+	static constexpr std::size_t value() {
+		if constexpr(std::is_base_of_v<optional_serializer<T>, serializer<std::optional<T>>>) {
+			return 1;
+		} else {
+			return 0;
+		}
+	}
+};
+
+template <typename, typename = std::void_t<>>
+struct has_serializer_max_size : std::false_type {};
+template <typename S>
+struct has_serializer_max_size<S, std::void_t<decltype(S::max_size())>> : std::true_type {};
+
+// Sum of the given maximum sizes, which is unbounded (std::nullopt) if any of them is.
+constexpr std::optional<std::size_t> sum_max_sizes(std::initializer_list<std::optional<std::size_t>> sizes) {
+	std::size_t res = 0;
+	for(const auto& size : sizes) {
+		if(!size) return std::nullopt;
+		res += *size;
+	}
+	return res;
+}
+constexpr std::optional<std::size_t> largest_max_size(std::initializer_list<std::optional<std::size_t>> sizes) {
+	std::size_t res = 0;
+	for(const auto& size : sizes) {
+		if(!size) return std::nullopt;
+		res = std::max(res, *size);
+	}
+	return res;
+}
+
+// Determines the maximum serialized size of T in the format Policy, or std::nullopt if it is unbounded.
+// In varint_format, integers (including enums and variant indices) can be longer than their fixed width, therefore
+// the fixed sizes are only used for types not containing them there.
+template <typename T, typename Policy>
+struct max_size_helper {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(has_fixed_serialized_size_v<T> && !Policy::varint_integers) {
+			return serialized_size<T>();
+		} else if constexpr(std::is_base_of_v<integral_serializer<T>, serializer<T>>) {
+			// Up to 7 bits per byte, ZigZag mapping doesn't need more bits than the value itself.
+			return (sizeof(T) * CHAR_BIT + 6) / 7;
+		} else if constexpr(std::is_enum_v<T> && std::is_base_of_v<general_serializer<T>, serializer<T>>) {
+			return max_size_helper<std::underlying_type_t<T>, Policy>::value();
+		} else if constexpr(has_serializer_max_size<serializer<T>>::value) {
+			return serializer<T>::max_size();
+		} else if constexpr(std::is_base_of_v<presence_bitmap_serializer<T>, serializer<T>>) {
+			using fields_seq = std::make_index_sequence<boost::pfr::tuple_size_v<T>>;
+			constexpr auto fields = presence_bitmap_fields_value(fields_seq{});
+			using bitmap = typename presence_bitmap_serializer<T>::bitmap;
+			return sum_max_sizes({max_size_helper<bitmap, Policy>::value(), fields});
+		} else if constexpr(std::is_base_of_v<array_serializer<T>, serializer<T>>) {
+			constexpr auto elem = max_size_helper<std::remove_cv_t<typename array_helper<T>::type>, Policy>::value();
+			if constexpr(elem.has_value()) {
+				return *elem * array_helper<T>::size;
+			} else {
+				return std::nullopt;
+			}
+		} else if constexpr(std::is_aggregate_v<T> && !std::is_array_v<T> &&
+							 std::is_base_of_v<general_serializer<T>, serializer<T>>) {
+			return fields_value(std::make_index_sequence<boost::pfr::tuple_size_v<T>>{});
+		} else if constexpr(has_fixed_serialized_size_v<T>) {
+			// Types with their own fixed-size serializer, e.g. std::monostate or std::bitset.
+			return serialized_size<T>();
+		} else {
+			return std::nullopt;
+		}
+	}
+
+private:
+	template <std::size_t... indseq>
+	static constexpr std::optional<std::size_t> fields_value(std::index_sequence<indseq...>) {
+		return sum_max_sizes(
+				{max_size_helper<std::remove_cv_t<boost::pfr::tuple_element_t<indseq, T>>, Policy>::value()...});
+	}
+	template <std::size_t... indseq>
+	static constexpr std::optional<std::size_t> presence_bitmap_fields_value(std::index_sequence<indseq...>) {
+		using pb_serializer = presence_bitmap_serializer<T>;
+		return sum_max_sizes(
+				{max_size_helper<typename pb_serializer::template field_info<indseq>::value_type, Policy>::value()...});
+	}
+};
+template <typename Policy, typename... T>
+struct max_size_helper<std::tuple<T...>, Policy> {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(has_fixed_serialized_size_v<std::tuple<T...>> && !Policy::varint_integers) {
+			return serialized_size<std::tuple<T...>>();
+		} else if constexpr(std::is_base_of_v<tuple_serializer<T...>, serializer<std::tuple<T...>>>) {
+			return sum_max_sizes({max_size_helper<std::remove_cv_t<T>, Policy>::value()...});
+		} else {
+			return std::nullopt;
+		}
+	}
+};
+template <typename Policy, typename FT, typename ST>
+struct max_size_helper<std::pair<FT, ST>, Policy> {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(has_fixed_serialized_size_v<std::pair<FT, ST>> && !Policy::varint_integers) {
+			return serialized_size<std::pair<FT, ST>>();
+		} else if constexpr(std::is_base_of_v<pair_serializer<FT, ST>, serializer<std::pair<FT, ST>>>) {
+			return sum_max_sizes({max_size_helper<std::remove_cv_t<FT>, Policy>::value(),
+								  max_size_helper<std::remove_cv_t<ST>, Policy>::value()});
+		} else {
+			return std::nullopt;
+		}
+	}
+};
+template <typename Policy, typename... T>
+struct max_size_helper<std::variant<T...>, Policy> {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(std::is_base_of_v<variant_serializer<T...>, serializer<std::variant<T...>>>) {
+			return sum_max_sizes({max_size_helper<sufficient_uint_t<sizeof...(T)>, Policy>::value(),
+								  largest_max_size({max_size_helper<std::remove_cv_t<T>, Policy>::value()...})});
+		} else {
+			return std::nullopt;
+		}
+	}
+};
+template <typename Policy, auto... values>
+struct max_size_helper<magic_number<values...>, Policy> {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(std::is_base_of_v<magic_number_serializer<values...>, serializer<magic_number<values...>>>) {
+			return sum_max_sizes({max_size_helper<std::remove_cv_t<decltype(values)>, Policy>::value()...});
+		} else {
+			return std::nullopt;
+		}
+	}
+};
+template <typename Policy, typename T>
+struct max_size_helper<std::optional<T>, Policy> {
+	static constexpr std::optional<std::size_t> value() {
+		if constexpr(std::is_base_of_v<optional_serializer<T>, serializer<std::optional<T>>>) {
+			return sum_max_sizes({std::size_t{1}, max_size_helper<std::remove_cv_t<T>, Policy>::value()});
+		} else {
+			return std::nullopt;
+		}
+	}
+};
+
+template <typename, typename = std::void_t<>>
+struct has_write_reservation_members : std::false_type {};
+template <typename T>
+struct has_write_reservation_members<
+		T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t{})),
+					   decltype(std::size_t{std::declval<const T&>().writable_capacity()}),
+					   decltype(std::size_t{std::declval<const T&>().total_capacity()})>> : std::true_type {};
+
+} // namespace detail
+
+// Indicates if the buffer type supports reserving capacity for upcoming writes, in which case the reserving
+// serialization functions compute the size of the serialized data in advance.
+template <typename Buff>
+constexpr bool supports_write_reservation_v = detail::has_write_reservation_members<Buff>::value;
+
+// Ensures that the given buffer can take the given number of additional bytes without reallocating.
+// If the buffer needs to grow for this, it grows by at least its current capacity, to not lose the amortized
+// constant growth cost when many small messages are reserved for one after the other.
+// Does nothing for buffers that don't support write reservations.
+template <typename Buff>
+void reserve_for_write(Buff& buffer, std::size_t bytes) {
+	if constexpr(supports_write_reservation_v<Buff>) {
+		if(buffer.writable_capacity() < bytes) {
+			buffer.reserve(std::max(bytes, buffer.total_capacity()));
+		}
+	} else {
+		static_cast<void>(buffer);
+		static_cast<void>(bytes);
+	}
+}
+
 template <typename Buff, typename T>
 void serialize(Buff& buffer, const T& val) {
 	serializer<std::remove_const_t<T>>::serialize(buffer, val);
@@ -768,23 +2517,507 @@ T deserialize(Buff& buffer) {
 	return serializer<std::remove_const_t<T>>::deserialize(buffer);
 }
 
+namespace detail {
+// Buffer adapter used by try_deserialize, that turns read failures and invalid data into an error code instead of
+// exceptions. After the first error, reads don't consume any more data and return zero bytes, so that the
+// deserialization can run to its end without further checks and the result is discarded.
+template <typename Buff>
+class error_code_buffer {
+	Buff& buffer_;
+	std::error_code& ec_;
+
+public:
+	using format_policy = buffer_format_t<Buff>;
+
+	error_code_buffer(Buff& buffer, std::error_code& ec) noexcept : buffer_{buffer}, ec_{ec} {}
+
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		if(!ec_) {
+			if(auto data = buffer_.template try_read<bytes>()) return *data;
+			ec_ = make_error_code(errc::insufficient_data);
+		}
+		return {};
+	}
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() {
+		if(ec_) return std::nullopt;
+		return buffer_.template try_read<bytes>();
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_read_into_member_v<B>, int> = 0>
+	void read_into(std::span<std::byte> data) {
+		if(!ec_ && !buffer_.try_read_into(data)) ec_ = make_error_code(errc::insufficient_data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_skip_member_v<B>, int> = 0>
+	void skip(std::size_t bytes) {
+		if(!ec_ && !buffer_.try_skip(bytes)) ec_ = make_error_code(errc::insufficient_data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_read_view_member_v<B>, int> = 0>
+	std::span<const std::byte> read_view(std::size_t bytes) {
+		if(!ec_) {
+			if(auto view = buffer_.try_read_view(bytes)) return *view;
+			ec_ = make_error_code(errc::insufficient_data);
+		}
+		return {};
+	}
+
+	template <typename B = Buff, std::enable_if_t<has_available_bytes_member_v<B>, int> = 0>
+	std::size_t available_bytes() const noexcept {
+		return ec_ ? 0 : buffer_.available_bytes();
+	}
+	template <typename B = Buff, std::enable_if_t<has_available_data_member_v<B>, int> = 0>
+	std::span<const std::byte> available_data() const noexcept {
+		if(ec_) return {};
+		return buffer_.available_data();
+	}
+
+	void report_error(errc e) noexcept {
+		if(!ec_) ec_ = make_error_code(e);
+	}
+	bool failed() const noexcept {
+		return bool(ec_);
+	}
+};
+
+// Base class for buffer adapters that add (de)serialization state to a buffer. All buffer operations are forwarded to
+// the adapted buffer, including the optional ones and those of adapters nested inside of it.
+template <typename Buff>
+class forwarding_buffer {
+protected:
+	Buff& buffer_;
+
+public:
+	using format_policy = buffer_format_t<Buff>;
+
+	explicit forwarding_buffer(Buff& buffer) noexcept : buffer_{buffer} {}
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		buffer_.write(data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_span_write_member_v<B>, int> = 0>
+	void write(std::span<const std::byte> data) {
+		buffer_.write(data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_write_reservation_members<B>::value, int> = 0>
+	void reserve(std::size_t bytes) {
+		buffer_.reserve(bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_write_reservation_members<B>::value, int> = 0>
+	std::size_t writable_capacity() const {
+		return buffer_.writable_capacity();
+	}
+	template <typename B = Buff, std::enable_if_t<has_write_reservation_members<B>::value, int> = 0>
+	std::size_t total_capacity() const {
+		return buffer_.total_capacity();
+	}
+
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		return buffer_.template read<bytes>();
+	}
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() {
+		return buffer_.template try_read<bytes>();
+	}
+	template <typename B = Buff, std::enable_if_t<has_read_into_member_v<B>, int> = 0>
+	void read_into(std::span<std::byte> data) {
+		buffer_.read_into(data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_read_into_member_v<B>, int> = 0>
+	bool try_read_into(std::span<std::byte> data) {
+		return buffer_.try_read_into(data);
+	}
+	template <typename B = Buff, std::enable_if_t<has_read_view_member_v<B>, int> = 0>
+	std::span<const std::byte> read_view(std::size_t bytes) {
+		return buffer_.read_view(bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_read_view_member_v<B>, int> = 0>
+	std::optional<std::span<const std::byte>> try_read_view(std::size_t bytes) {
+		return buffer_.try_read_view(bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_skip_member_v<B>, int> = 0>
+	void skip(std::size_t bytes) {
+		buffer_.skip(bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_try_skip_member_v<B>, int> = 0>
+	bool try_skip(std::size_t bytes) {
+		return buffer_.try_skip(bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_available_bytes_member_v<B>, int> = 0>
+	std::size_t available_bytes() const noexcept {
+		return buffer_.available_bytes();
+	}
+	template <typename B = Buff, std::enable_if_t<has_available_data_member_v<B>, int> = 0>
+	std::span<const std::byte> available_data() const noexcept {
+		return buffer_.available_data();
+	}
+	template <typename B = Buff, std::enable_if_t<has_error_reporting_members<B>::value, int> = 0>
+	void report_error(errc e) {
+		buffer_.report_error(e);
+	}
+	template <typename B = Buff, std::enable_if_t<has_error_reporting_members<B>::value, int> = 0>
+	bool failed() const noexcept {
+		return buffer_.failed();
+	}
+	template <typename B = Buff, std::enable_if_t<has_decode_limits_members<B>::value, int> = 0>
+	bool enter_container(std::size_t length, std::size_t element_bytes) {
+		return buffer_.enter_container(length, element_bytes);
+	}
+	template <typename B = Buff, std::enable_if_t<has_decode_limits_members<B>::value, int> = 0>
+	void leave_container() noexcept {
+		buffer_.leave_container();
+	}
+	template <typename B = Buff, std::enable_if_t<has_memory_resource_member<B>::value, int> = 0>
+	std::pmr::memory_resource* memory_resource() const noexcept {
+		return buffer_.memory_resource();
+	}
+};
+
+// Buffer adapter that enforces decode_limits on the containers deserialized through it.
+template <typename Buff>
+class limited_buffer : public forwarding_buffer<Buff> {
+	decode_limits limits_;
+	std::size_t total_bytes_ = 0;
+	std::size_t depth_ = 0;
+
+	bool report_limit_error(const char* message) {
+		if constexpr(has_error_reporting_members<Buff>::value) {
+			this->buffer_.report_error(errc::limit_exceeded);
+			return false;
+		} else {
+			throw decode_limit_error(message);
+		}
+	}
+
+public:
+	limited_buffer(Buff& buffer, const decode_limits& limits) noexcept
+			: forwarding_buffer<Buff>(buffer), limits_{limits} {}
+
+	bool enter_container(std::size_t length, std::size_t element_bytes) {
+		if(depth_ >= limits_.max_depth) return report_limit_error("Container nesting exceeds the decode limits.");
+		if(length > limits_.max_elements) return report_limit_error("Container length exceeds the decode limits.");
+		auto remaining_bytes = limits_.max_total_bytes - std::min(total_bytes_, limits_.max_total_bytes);
+		if(element_bytes != 0 && length > remaining_bytes / element_bytes) {
+			return report_limit_error("Container contents exceed the decode limits.");
+		}
+		total_bytes_ += length * element_bytes;
+		++depth_;
+		return true;
+	}
+	void leave_container() noexcept {
+		--depth_;
+	}
+};
+
+// Buffer adapter that supplies the memory resource for containers using std::pmr::polymorphic_allocator that are
+// deserialized through it.
+template <typename Buff>
+class memory_resource_buffer : public forwarding_buffer<Buff> {
+	std::pmr::memory_resource* resource_;
+
+public:
+	memory_resource_buffer(Buff& buffer, std::pmr::memory_resource& resource) noexcept
+			: forwarding_buffer<Buff>(buffer), resource_{&resource} {}
+
+	std::pmr::memory_resource* memory_resource() const noexcept {
+		return resource_;
+	}
+};
+
+// Buffer adapter that applies the given wire format policy to the (de)serialization through it.
+template <typename Policy, typename Buff>
+class format_buffer : public forwarding_buffer<Buff> {
+public:
+	using format_policy = Policy;
+
+	explicit format_buffer(Buff& buffer) noexcept : forwarding_buffer<Buff>(buffer) {}
+};
+
+// Buffer that only counts the bytes written to it, to determine the serialized size of values in formats where the
+// size members of the serializers don't apply.
+template <typename Format>
+class size_counting_buffer {
+	std::size_t size_ = 0;
+
+public:
+	using format_policy = Format;
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>&) noexcept {
+		size_ += bytes;
+	}
+	void write(std::span<const std::byte> data) noexcept {
+		size_ += data.size();
+	}
+	std::size_t size() const noexcept {
+		return size_;
+	}
+};
+} // namespace detail
+
+// Variant of deserialize that fails with decode_limit_error if the data exceed the given limits.
+template <typename T, typename Buff>
+T deserialize(Buff& buffer, const decode_limits& limits) {
+	detail::limited_buffer<Buff> limited(buffer, limits);
+	return deserialize<T>(limited);
+}
+
+// Variant of deserialize that allocates the storage of all containers in the value that use
+// std::pmr::polymorphic_allocator (e.g. std::pmr::string and std::pmr::vector) from the given memory resource.
+template <typename T, typename Buff>
+T deserialize(Buff& buffer, std::pmr::memory_resource& resource) {
+	detail::memory_resource_buffer<Buff> resource_buffer(buffer, resource);
+	return deserialize<T>(resource_buffer);
+}
+
+// Non-throwing variant of deserialize: If the buffer doesn't contain enough data or the data are invalid, the
+// corresponding errc is stored in ec and std::nullopt is returned, instead of throwing buffer_length_error or
+// deserialization_data_error. The buffer is then left at an unspecified position within the value.
+// Note that errors of the underlying I/O and from custom serializers can still be thrown.
+template <typename T, typename Buff>
+std::optional<T> try_deserialize(Buff& buffer, std::error_code& ec) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	auto val = deserialize<T>(ec_buffer);
+	if(ec) return std::nullopt;
+	return val;
+}
+// Variant of try_deserialize that allocates from the given memory resource, see deserialize.
+template <typename T, typename Buff>
+std::optional<T> try_deserialize(Buff& buffer, std::error_code& ec, std::pmr::memory_resource& resource) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	detail::memory_resource_buffer<detail::error_code_buffer<Buff>> resource_buffer(ec_buffer, resource);
+	auto val = deserialize<T>(resource_buffer);
+	if(ec) return std::nullopt;
+	return val;
+}
+// Variant of try_deserialize that fails with errc::limit_exceeded if the data exceed the given limits.
+template <typename T, typename Buff>
+std::optional<T> try_deserialize(Buff& buffer, std::error_code& ec, const decode_limits& limits) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	detail::limited_buffer<detail::error_code_buffer<Buff>> limited(ec_buffer, limits);
+	auto val = deserialize<T>(limited);
+	if(ec) return std::nullopt;
+	return val;
+}
+
+namespace detail {
+template <typename, typename, typename, typename = std::void_t<>>
+struct has_deserialize_into_member : std::false_type {};
+template <typename S, typename Buff, typename T>
+struct has_deserialize_into_member<
+		S, Buff, T, std::void_t<decltype(S::deserialize_into(std::declval<Buff&>(), std::declval<T&>()))>>
+		: std::true_type {};
+template <typename, typename, typename = std::void_t<>>
+struct has_serializer_skip : std::false_type {};
+template <typename S, typename Buff>
+struct has_serializer_skip<S, Buff, std::void_t<decltype(S::skip(std::declval<Buff&>()))>> : std::true_type {};
+template <typename, typename, typename = std::void_t<>>
+struct has_serializer_validate : std::false_type {};
+template <typename S, typename Buff>
+struct has_serializer_validate<S, Buff, std::void_t<decltype(S::validate(std::declval<Buff&>()))>> : std::true_type {};
+} // namespace detail
+
+// Deserializes a T into the existing object target, reusing the storage it already owns where possible. That is,
+// containers (also inside of aggregates, tuples, optionals and variants) keep their capacity and allocated elements,
+// so repeatedly decoding into the same object can avoid allocations once the storage has grown large enough.
+// Types whose serializer doesn't provide a deserialize_into member are deserialized normally and assigned to target.
+template <typename Buff, typename T>
+void deserialize_into(Buff& buffer, T& target) {
+	using ser = serializer<T>;
+	if constexpr(detail::has_deserialize_into_member<ser, Buff, T>::value) {
+		ser::deserialize_into(buffer, target);
+	} else {
+		target = ser::deserialize(buffer);
+	}
+}
+
+// Non-throwing variant of deserialize_into, see try_deserialize.
+// Returns false if an error occurred, in which case target is left in a valid but unspecified state.
+template <typename Buff, typename T>
+bool try_deserialize_into(Buff& buffer, T& target, std::error_code& ec) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	deserialize_into(ec_buffer, target);
+	return !ec;
+}
+
+// Variants of deserialize_into and try_deserialize_into that enforce the given limits.
+template <typename Buff, typename T>
+void deserialize_into(Buff& buffer, T& target, const decode_limits& limits) {
+	detail::limited_buffer<Buff> limited(buffer, limits);
+	deserialize_into(limited, target);
+}
+template <typename Buff, typename T>
+bool try_deserialize_into(Buff& buffer, T& target, std::error_code& ec, const decode_limits& limits) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	detail::limited_buffer<detail::error_code_buffer<Buff>> limited(ec_buffer, limits);
+	deserialize_into(limited, target);
+	return !ec;
+}
+
+// Advances the buffer past a serialized T without deserializing it.
+// Fixed-size types are skipped as a whole, containers of fixed-size elements based on their length, and only other
+// types are traversed element-wise. The data are only checked as far as necessary to determine their length, use
+// validate for a complete check. Types whose serializer doesn't provide a skip member are deserialized and discarded.
+template <typename T, typename Buff>
+void skip(Buff& buffer) {
+	using ser = serializer<std::remove_const_t<T>>;
+	if constexpr(detail::has_fixed_size_in_format_v<T, Buff>) {
+		detail::skip_bytes(buffer, serialized_size<T>());
+	} else if constexpr(detail::has_serializer_skip<ser, Buff>::value) {
+		ser::skip(buffer);
+	} else {
+		static_cast<void>(ser::deserialize(buffer));
+	}
+}
+
+// Advances the buffer past a serialized T, checking that deserialize<T> would succeed on the data, but without
+// materializing the value. Reports errors the same way as deserialize.
+// Types whose serializer doesn't provide a validate member are deserialized and discarded.
+template <typename T, typename Buff>
+void validate(Buff& buffer) {
+	using ser = serializer<std::remove_const_t<T>>;
+	if constexpr(detail::has_serializer_validate<ser, Buff>::value) {
+		ser::validate(buffer);
+	} else {
+		static_cast<void>(ser::deserialize(buffer));
+	}
+}
+
+// Non-throwing variant of validate, see try_deserialize.
+template <typename T, typename Buff>
+bool try_validate(Buff& buffer, std::error_code& ec) {
+	ec.clear();
+	detail::error_code_buffer<Buff> ec_buffer(buffer, ec);
+	validate<T>(ec_buffer);
+	return !ec;
+}
+
 template <typename T>
 constexpr std::size_t serialized_size() {
 	return serializer<std::remove_const_t<T>>::size();
 }
 
+// The largest number of bytes a T can be serialized as in the given format, e.g. for sizing a static_buffer at compile
+// time. In varint_format, this accounts for integers taking up to one byte per 7 bits of their width.
+template <typename T, typename Policy = big_endian_format>
+constexpr std::size_t max_serialized_size() {
+	static_assert(is_format_policy_v<Policy>, "The second template argument must be a wire format policy.");
+	static_assert(has_bounded_serialized_size_v<T, Policy>, "The serialized size of the type is unbounded.");
+	return *detail::max_size_helper<std::remove_cv_t<T>, Policy>::value();
+}
+
 template <typename T>
 std::size_t serialized_size(const T& val) {
 	return serializer<std::remove_const_t<T>>::size(val);
 }
 
+// Serializes val, reserving the required capacity in the buffer once in advance, instead of letting it grow
+// incrementally during the serialization.
+// The size pass is skipped if the buffer doesn't support write reservations (see supports_write_reservation_v).
+template <typename Buff, typename T>
+void serialize_reserved(Buff& buffer, const T& val) {
+	if constexpr(supports_write_reservation_v<Buff>) {
+		reserve_for_write(buffer, serialized_size(val));
+	}
+	serialize(buffer, val);
+}
+// Same as above, but with the serialized size of val already known by the caller, e.g. because it was needed for a
+// length prefix.
+template <typename Buff, typename T>
+void serialize_reserved(Buff& buffer, const T& val, std::size_t size) {
+	reserve_for_write(buffer, size);
+	serialize(buffer, val);
+}
+
+// Variants of the (de)serialization functions that use the given wire format policy (e.g. little_endian_format or
+// varint_format) instead of big_endian_format. The remaining arguments are the same as for the default format.
+// Both sides of a transfer need to use the same policy, as the data don't indicate it.
+template <typename Policy, typename Buff, typename T, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void serialize(Buff& buffer, const T& val) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	serialize(format_buffer, val);
+}
+template <typename T, typename Policy, typename Buff, typename... Args,
+		  std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+T deserialize(Buff& buffer, Args&&... args) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	return deserialize<T>(format_buffer, std::forward<Args>(args)...);
+}
+template <typename T, typename Policy, typename Buff, typename... Args,
+		  std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+std::optional<T> try_deserialize(Buff& buffer, std::error_code& ec, Args&&... args) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	return try_deserialize<T>(format_buffer, ec, std::forward<Args>(args)...);
+}
+template <typename Policy, typename Buff, typename T, typename... Args,
+		  std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void deserialize_into(Buff& buffer, T& target, Args&&... args) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	deserialize_into(format_buffer, target, std::forward<Args>(args)...);
+}
+template <typename Policy, typename Buff, typename T, typename... Args,
+		  std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+bool try_deserialize_into(Buff& buffer, T& target, std::error_code& ec, Args&&... args) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	return try_deserialize_into(format_buffer, target, ec, std::forward<Args>(args)...);
+}
+template <typename T, typename Policy, typename Buff, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void skip(Buff& buffer) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	skip<T>(format_buffer);
+}
+template <typename T, typename Policy, typename Buff, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void validate(Buff& buffer) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	validate<T>(format_buffer);
+}
+template <typename T, typename Policy, typename Buff, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+bool try_validate(Buff& buffer, std::error_code& ec) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	return try_validate<T>(format_buffer, ec);
+}
+// The sizes in the fixed-width formats are the same as in the default format. For varint_format, the size is
+// determined by encoding the value without storing the result.
+template <typename Policy, typename T, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+std::size_t serialized_size(const T& val) {
+	if constexpr(Policy::varint_integers) {
+		detail::size_counting_buffer<Policy> counter;
+		serialize(counter, val);
+		return counter.size();
+	} else {
+		return serialized_size(val);
+	}
+}
+template <typename T, typename Policy, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+constexpr std::size_t serialized_size() {
+	static_assert(!Policy::varint_integers, "The format has no fixed serialized sizes.");
+	return serialized_size<T>();
+}
+
+// Writes / checks the version signature of the format used by the buffer (by default big_endian_format).
 template <typename Buff>
 void write_format_version_header(Buff& buffer) {
-	serialize(buffer, format_version_magic_number);
+	serialize(buffer, format_version_magic_number_for_t<detail::buffer_format_t<Buff>>{});
 }
 template <typename Buff>
 void check_format_version_header(Buff& buffer) {
-	deserialize<format_version_magic_number_t>(buffer);
+	deserialize<format_version_magic_number_for_t<detail::buffer_format_t<Buff>>>(buffer);
+}
+template <typename Policy, typename Buff, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void write_format_version_header(Buff& buffer) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	write_format_version_header(format_buffer);
+}
+template <typename Policy, typename Buff, std::enable_if_t<is_format_policy_v<Policy>, int> = 0>
+void check_format_version_header(Buff& buffer) {
+	detail::format_buffer<Policy, Buff> format_buffer(buffer);
+	check_format_version_header(format_buffer);
 }
 
 } // namespace structocol
@@ -0,0 +1,168 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_SPAN_BUFFER_INCLUDED
+#define STRUCTOCOL_SPAN_BUFFER_INCLUDED
+
+#include "exceptions.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <span>
+
+namespace structocol {
+
+namespace detail {
+
+// Throwing and array-returning read members of the memory buffers, implemented in terms of the try_read_into and
+// try_skip members of Derived.
+template <typename Derived>
+class buffer_read_members {
+	Derived& derived() noexcept {
+		return static_cast<Derived&>(*this);
+	}
+
+public:
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		std::array<std::byte, bytes> ret;
+		read_into(ret);
+		return ret;
+	}
+
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() {
+		std::optional<std::array<std::byte, bytes>> ret = std::array<std::byte, bytes>{};
+		if(!derived().try_read_into(*ret)) return std::nullopt;
+		return ret;
+	}
+
+	void read_into(std::span<std::byte> data) {
+		if(!derived().try_read_into(data)) throw buffer_length_error("Not enough bytes left in buffer.");
+	}
+
+	// Consumes the given number of bytes without reading them.
+	void skip(std::size_t bytes) {
+		if(!derived().try_skip(bytes)) throw buffer_length_error("Not enough bytes left in buffer.");
+	}
+};
+
+// Read interface of the buffers whose readable data are contiguous in memory, e.g. span_read_buffer and static_buffer.
+// Derived provides available_data() and consume(std::size_t), which drops the given number of bytes from its front.
+template <typename Derived>
+class contiguous_read_members : public buffer_read_members<Derived> {
+	Derived& derived() noexcept {
+		return static_cast<Derived&>(*this);
+	}
+	const Derived& derived() const noexcept {
+		return static_cast<const Derived&>(*this);
+	}
+
+public:
+	bool try_read_into(std::span<std::byte> data) noexcept {
+		auto available = derived().available_data();
+		if(data.size() > available.size()) return false;
+		std::copy_n(available.begin(), data.size(), data.begin());
+		derived().consume(data.size());
+		return true;
+	}
+
+	// Reads the given number of bytes without copying them, returning a view of them in the storage of the buffer.
+	std::span<const std::byte> read_view(std::size_t bytes) {
+		auto view = try_read_view(bytes);
+		if(!view) throw buffer_length_error("Not enough bytes left in buffer.");
+		return *view;
+	}
+
+	std::optional<std::span<const std::byte>> try_read_view(std::size_t bytes) noexcept {
+		auto available = derived().available_data();
+		if(bytes > available.size()) return std::nullopt;
+		derived().consume(bytes);
+		return available.first(bytes);
+	}
+
+	bool try_skip(std::size_t bytes) noexcept {
+		if(bytes > available_bytes()) return false;
+		derived().consume(bytes);
+		return true;
+	}
+
+	std::size_t available_bytes() const noexcept {
+		return derived().available_data().size();
+	}
+};
+
+} // namespace detail
+
+// Read-only buffer over caller-provided memory, e.g. a receive buffer or a shared memory segment, that is decoded
+// without copying it into a vector_buffer first. Provides the read interface of vector_buffer.
+// The memory must outlive the buffer and the borrowed views (see read_view) obtained from it.
+class span_read_buffer : public detail::contiguous_read_members<span_read_buffer> {
+	friend class detail::contiguous_read_members<span_read_buffer>;
+	std::span<const std::byte> data_;
+
+	void consume(std::size_t bytes) noexcept {
+		data_ = data_.subspan(bytes);
+	}
+
+public:
+	explicit span_read_buffer(std::span<const std::byte> data) noexcept : data_{data} {}
+
+	std::span<const std::byte> available_data() const noexcept {
+		return data_;
+	}
+};
+
+// Write-only buffer over caller-provided memory of a fixed size, e.g. a send buffer or a shared memory segment, that
+// is encoded into without copying from a vector_buffer afterwards. Provides the write interface of vector_buffer.
+// Writing more data than fit into the remaining space throws a buffer_length_error without writing any of them,
+// the data written by the preceding writes (e.g. the first fields of a message) remain in the buffer.
+class span_write_buffer {
+	std::span<std::byte> storage_;
+	std::size_t write_offset_ = 0;
+
+public:
+	explicit span_write_buffer(std::span<std::byte> storage) noexcept : storage_{storage} {}
+
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+		if(data.size() > free_bytes()) throw buffer_length_error("Not enough space left in buffer.");
+		std::copy(data.begin(), data.end(), storage_.begin() + write_offset_);
+		write_offset_ += data.size();
+	}
+
+	std::size_t capacity() const noexcept {
+		return storage_.size();
+	}
+
+	// The number of bytes that can still be written.
+	std::size_t free_bytes() const noexcept {
+		return storage_.size() - write_offset_;
+	}
+
+	// The written part of the underlying memory.
+	std::span<const std::byte> available_data() const noexcept {
+		return storage_.first(write_offset_);
+	}
+
+	std::size_t available_bytes() const noexcept {
+		return write_offset_;
+	}
+
+	// Discards the written data, so that writing starts again at the beginning of the underlying memory.
+	void clear() noexcept {
+		write_offset_ = 0;
+	}
+};
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_SPAN_BUFFER_INCLUDED
@@ -0,0 +1,87 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_STATIC_BUFFER_INCLUDED
+#define STRUCTOCOL_STATIC_BUFFER_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+#include <structocol/serialization.hpp>
+#include <structocol/span_buffer.hpp>
+
+#include "exceptions.hpp"
+
+namespace structocol {
+
+// Buffer with the same read and write interface as vector_buffer, but using inline storage of a fixed capacity of N
+// bytes, so that small messages can be encoded and decoded without allocating, e.g. on the stack.
+// Writing more data than fit into the remaining capacity throws a buffer_length_error. The unread data are moved to
+// the beginning of the storage when a write doesn't fit behind them otherwise. Views obtained by read_view remain valid
+// during further reads, but are invalidated by writing to, trimming or clearing the buffer.
+template <std::size_t N>
+class static_buffer : public detail::contiguous_read_members<static_buffer<N>> {
+	friend class detail::contiguous_read_members<static_buffer<N>>;
+	std::array<std::byte, N> storage_;
+	std::size_t read_offset_ = 0;
+	std::size_t write_offset_ = 0;
+
+	void consume(std::size_t bytes) noexcept {
+		read_offset_ += bytes;
+	}
+
+public:
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+		if(data.size() > N - write_offset_) {
+			if(data.size() > free_bytes()) throw buffer_length_error("Not enough space left in buffer.");
+			trim();
+		}
+		std::copy(data.begin(), data.end(), storage_.begin() + write_offset_);
+		write_offset_ += data.size();
+	}
+
+	// Moves the unread data to the beginning of the storage.
+	void trim() noexcept {
+		std::copy(storage_.begin() + read_offset_, storage_.begin() + write_offset_, storage_.begin());
+		write_offset_ -= read_offset_;
+		read_offset_ = 0;
+	}
+
+	static constexpr std::size_t capacity() noexcept {
+		return N;
+	}
+
+	// The number of bytes that can still be written.
+	std::size_t free_bytes() const noexcept {
+		return N - this->available_bytes();
+	}
+
+	// The bytes available for reading, as a contiguous memory region.
+	// Invalidated by all non-const operations on the buffer.
+	std::span<const std::byte> available_data() const noexcept {
+		return std::span<const std::byte>(storage_.data() + read_offset_, write_offset_ - read_offset_);
+	}
+
+	void clear() noexcept {
+		read_offset_ = 0;
+		write_offset_ = 0;
+	}
+};
+
+// A static_buffer large enough to hold any T serialized in the given format, which must have a bounded serialized size
+// (see max_serialized_size).
+template <typename T, typename Policy = big_endian_format>
+using static_buffer_for = static_buffer<max_serialized_size<T, Policy>()>;
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_STATIC_BUFFER_INCLUDED
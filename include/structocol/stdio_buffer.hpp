@@ -12,10 +12,28 @@
 #include <cstddef>
 #include <cstdio>
 #include <optional>
+#include <span>
 #include <stdexcept>
+#include <structocol/buffered_io.hpp>
 
 namespace structocol {
 
+namespace detail {
+inline void stdio_write(std::FILE* file_handle, std::span<const std::byte> data) {
+	auto bytes_written = fwrite(reinterpret_cast<const char*>(data.data()), 1, data.size(), file_handle);
+	if(bytes_written != data.size()) {
+		if(std::ferror(file_handle)) {
+			throw io_error("IO error while writing the supplied bytes.");
+			// The caller can still pull the exact error out of errno if they want to, but because std::strerror is
+			// not thread-safe, this function doesn't do that itself because it doesn't know if other threads are
+			// also calling std::strerror and what the locking strategy used by the calling application is.
+		} else {
+			throw io_error("fwrite() wrote less bytes than requested, but no error indication was set.");
+		}
+	}
+}
+} // namespace detail
+
 class stdio_buffer {
 	std::FILE* file_handle_;
 
@@ -25,8 +43,13 @@ public:
 	template <std::size_t bytes>
 	std::array<std::byte, bytes> read() {
 		std::array<std::byte, bytes> buf;
-		auto bytes_read = std::fread(reinterpret_cast<char*>(buf.data()), 1, buf.size(), file_handle_);
-		if(bytes_read != bytes) {
+		read_into(buf);
+		return buf;
+	}
+
+	void read_into(std::span<std::byte> data) {
+		auto bytes_read = std::fread(reinterpret_cast<char*>(data.data()), 1, data.size(), file_handle_);
+		if(bytes_read != data.size()) {
 			if(std::ferror(file_handle_)) {
 				throw io_error("IO error while reading the requested bytes.");
 				// The caller can still pull the exact error out of errno if they want to, but because std::strerror is
@@ -38,7 +61,6 @@ public:
 				throw io_error("fread() read less bytes than requested, but no error or EOF indication was set.");
 			}
 		}
-		return buf;
 	}
 
 	template <std::size_t bytes>
@@ -51,20 +73,64 @@ public:
 		return buf;
 	}
 
+	bool try_read_into(std::span<std::byte> data) {
+		return std::fread(reinterpret_cast<char*>(data.data()), 1, data.size(), file_handle_) == data.size();
+	}
+
 	template <std::size_t bytes>
 	void write(const std::array<std::byte, bytes>& data) {
-		auto bytes_written = fwrite(reinterpret_cast<const char*>(data.data()), 1, data.size(), file_handle_);
-		if(bytes_written != bytes) {
-			if(std::ferror(file_handle_)) {
-				throw io_error("IO error while writing the supplied bytes.");
-				// The caller can still pull the exact error out of errno if they want to, but because std::strerror is
-				// not thread-safe, this function doesn't do that itself because it doesn't know if other threads are
-				// also calling std::strerror and what the locking strategy used by the calling application is.
-			} else {
-				throw io_error("fwrite() wrote less bytes than requested, but no error indication was set.");
-			}
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
+		detail::stdio_write(file_handle_, data);
+	}
+};
+
+// Input buffer reading from a std::FILE* in blocks of the given size, so that reading individual fields doesn't need a
+// stdio call each. As the file is read ahead, its position is unspecified relative to the consumed data.
+class buffered_stdio_input_buffer : public detail::block_input_buffer<buffered_stdio_input_buffer> {
+	friend class detail::block_input_buffer<buffered_stdio_input_buffer>;
+	std::FILE* file_handle_;
+
+	std::size_t read_block(std::span<std::byte> data) {
+		auto bytes_read = std::fread(reinterpret_cast<char*>(data.data()), 1, data.size(), file_handle_);
+		if(bytes_read != data.size() && std::ferror(file_handle_)) {
+			throw io_error("IO error while reading the requested bytes.");
+		}
+		return bytes_read;
+	}
+
+public:
+	explicit buffered_stdio_input_buffer(std::FILE* file_handle, std::size_t block_size = default_io_block_size)
+			: block_input_buffer(block_size), file_handle_(file_handle) {}
+};
+
+// Output buffer writing to a std::FILE* in blocks of the given size, so that writing individual fields doesn't need a
+// stdio call each. See detail::block_output_buffer for when the data are written.
+class buffered_stdio_output_buffer : public detail::block_output_buffer<buffered_stdio_output_buffer> {
+	friend class detail::block_output_buffer<buffered_stdio_output_buffer>;
+	std::FILE* file_handle_;
+
+	void write_block(std::span<const std::byte> data) {
+		detail::stdio_write(file_handle_, data);
+	}
+
+public:
+	explicit buffered_stdio_output_buffer(std::FILE* file_handle, std::size_t block_size = default_io_block_size)
+			: block_output_buffer(block_size), file_handle_(file_handle) {}
+	~buffered_stdio_output_buffer() {
+		try {
+			flush_block();
+		} catch(...) {
 		}
 	}
+
+	// Writes the buffered data to the file and flushes it.
+	void flush() {
+		flush_block();
+		if(std::fflush(file_handle_) != 0) throw io_error("IO error while flushing the file.");
+	}
 };
 
 } // namespace structocol
@@ -9,8 +9,11 @@
 
 #include "exceptions.hpp"
 #include <array>
+#include <ios>
 #include <iostream>
 #include <optional>
+#include <span>
+#include <structocol/buffered_io.hpp>
 
 namespace structocol {
 
@@ -23,11 +26,20 @@ public:
 	template <std::size_t bytes>
 	std::array<std::byte, bytes> read() {
 		std::array<std::byte, bytes> buf;
-		stream_.read(reinterpret_cast<char*>(buf.data()), buf.size());
-		if(!stream_) throw io_error("Couldn't read the requested amount of bytes.");
+		read_into(buf);
 		return buf;
 	}
 
+	void read_into(std::span<std::byte> data) {
+		stream_.read(reinterpret_cast<char*>(data.data()), data.size());
+		if(!stream_) throw io_error("Couldn't read the requested amount of bytes.");
+	}
+
+	bool try_read_into(std::span<std::byte> data) {
+		stream_.read(reinterpret_cast<char*>(data.data()), data.size());
+		return bool(stream_);
+	}
+
 	template <std::size_t bytes>
 	std::optional<std::array<std::byte, bytes>> try_read() {
 		std::array<std::byte, bytes> buf;
@@ -47,11 +59,69 @@ public:
 
 	template <std::size_t bytes>
 	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
 		stream_.write(reinterpret_cast<const char*>(data.data()), data.size());
 		if(!stream_) throw io_error("Couldn't write the given amount of bytes.");
 	}
 };
 
+// Input buffer reading from the stream buffer of a std::istream in blocks of the given size, bypassing the sentry
+// construction of the stream for individual fields. Sets eofbit on the stream when its end is reached.
+// As the stream is read ahead, its position is unspecified relative to the consumed data.
+class buffered_istream_buffer : public detail::block_input_buffer<buffered_istream_buffer> {
+	friend class detail::block_input_buffer<buffered_istream_buffer>;
+	std::istream& stream_;
+
+	std::size_t read_block(std::span<std::byte> data) {
+		auto stream_buf = stream_.rdbuf();
+		if(!stream_buf) throw io_error("The stream has no stream buffer.");
+		auto size = std::streamsize(data.size());
+		auto bytes_read = std::size_t(stream_buf->sgetn(reinterpret_cast<char*>(data.data()), size));
+		if(bytes_read != data.size()) stream_.setstate(std::ios_base::eofbit);
+		return bytes_read;
+	}
+
+public:
+	explicit buffered_istream_buffer(std::istream& stream, std::size_t block_size = default_io_block_size)
+			: block_input_buffer(block_size), stream_{stream} {}
+};
+
+// Output buffer writing to the stream buffer of a std::ostream in blocks of the given size, bypassing the sentry
+// construction of the stream for individual fields. See detail::block_output_buffer for when the data are written.
+class buffered_ostream_buffer : public detail::block_output_buffer<buffered_ostream_buffer> {
+	friend class detail::block_output_buffer<buffered_ostream_buffer>;
+	std::ostream& stream_;
+
+	void write_block(std::span<const std::byte> data) {
+		auto stream_buf = stream_.rdbuf();
+		auto size = std::streamsize(data.size());
+		if(!stream_buf || stream_buf->sputn(reinterpret_cast<const char*>(data.data()), size) != size) {
+			stream_.setstate(std::ios_base::badbit);
+			throw io_error("Couldn't write the given amount of bytes.");
+		}
+	}
+
+public:
+	explicit buffered_ostream_buffer(std::ostream& stream, std::size_t block_size = default_io_block_size)
+			: block_output_buffer(block_size), stream_{stream} {}
+	~buffered_ostream_buffer() {
+		try {
+			flush_block();
+		} catch(...) {
+		}
+	}
+
+	// Writes the buffered data to the stream and flushes it.
+	void flush() {
+		flush_block();
+		stream_.flush();
+		if(!stream_) throw io_error("Couldn't flush the stream.");
+	}
+};
+
 } // namespace structocol
 
 #endif // STRUCTOCOL_STREAM_BUFFER_INCLUDED
@@ -7,14 +7,25 @@
 #ifndef STRUCTOCOL_MAIN_HEADER_INCLUDED
 #define STRUCTOCOL_MAIN_HEADER_INCLUDED
 
+#include "buffered_io.hpp"
 #include "buffers_ring.hpp"
+#include "error_code.hpp"
+#include "fd_buffer.hpp"
+#include "incremental_decoder.hpp"
+#include "mmap_buffer.hpp"
 #include "multiplexing.hpp"
 #include "protocol_handler.hpp"
 #include "recycling_buffers_queue.hpp"
+#include "ring_buffer.hpp"
+#include "scanning.hpp"
 #include "serialization.hpp"
+#include "span_buffer.hpp"
+#include "static_buffer.hpp"
 #include "stdio_buffer.hpp"
 #include "stream_buffer.hpp"
 #include "type_utilities.hpp"
+#include "varint_sequence.hpp"
 #include "vector_buffer.hpp"
+#include "view.hpp"
 
 #endif // STRUCTOCOL_MAIN_HEADER_INCLUDED
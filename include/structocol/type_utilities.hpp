@@ -10,6 +10,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <optional>
+#include <span>
 #include <type_traits>
 
 namespace structocol {
@@ -96,6 +98,81 @@ struct has_clear_member<T, std::void_t<decltype(std::declval<T&>().clear())>> :
 template <class T>
 inline constexpr bool has_clear_member_v = has_clear_member<T>::value;
 
+template <typename, typename = std::void_t<>>
+struct has_span_write_member : std::false_type {};
+template <typename T>
+struct has_span_write_member<
+		T, std::void_t<decltype(std::declval<T&>().write(std::declval<std::span<const std::byte>>()))>>
+		: std::true_type {};
+template <class T>
+inline constexpr bool has_span_write_member_v = has_span_write_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_read_into_member : std::false_type {};
+template <typename T>
+struct has_read_into_member<T, std::void_t<decltype(std::declval<T&>().read_into(std::declval<std::span<std::byte>>()))>>
+		: std::true_type {};
+template <class T>
+inline constexpr bool has_read_into_member_v = has_read_into_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_try_read_into_member : std::false_type {};
+template <typename T>
+struct has_try_read_into_member<
+		T, std::void_t<decltype(bool{std::declval<T&>().try_read_into(std::declval<std::span<std::byte>>())})>>
+		: std::true_type {};
+template <class T>
+inline constexpr bool has_try_read_into_member_v = has_try_read_into_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_read_view_member : std::false_type {};
+template <typename T>
+struct has_read_view_member<T, std::void_t<decltype(std::span<const std::byte>{
+											   std::declval<T&>().read_view(std::size_t{})})>> : std::true_type {};
+template <class T>
+inline constexpr bool has_read_view_member_v = has_read_view_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_try_read_view_member : std::false_type {};
+template <typename T>
+struct has_try_read_view_member<
+		T, std::void_t<decltype(std::optional<std::span<const std::byte>>{
+				   std::declval<T&>().try_read_view(std::size_t{})})>> : std::true_type {};
+template <class T>
+inline constexpr bool has_try_read_view_member_v = has_try_read_view_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_skip_member : std::false_type {};
+template <typename T>
+struct has_skip_member<T, std::void_t<decltype(std::declval<T&>().skip(std::size_t{}))>> : std::true_type {};
+template <class T>
+inline constexpr bool has_skip_member_v = has_skip_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_try_skip_member : std::false_type {};
+template <typename T>
+struct has_try_skip_member<T, std::void_t<decltype(bool{std::declval<T&>().try_skip(std::size_t{})})>>
+		: std::true_type {};
+template <class T>
+inline constexpr bool has_try_skip_member_v = has_try_skip_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_available_bytes_member : std::false_type {};
+template <typename T>
+struct has_available_bytes_member<
+		T, std::void_t<decltype(std::size_t{std::declval<const T&>().available_bytes()})>> : std::true_type {};
+template <class T>
+inline constexpr bool has_available_bytes_member_v = has_available_bytes_member<T>::value;
+
+template <typename, typename = std::void_t<>>
+struct has_available_data_member : std::false_type {};
+template <typename T>
+struct has_available_data_member<
+		T, std::void_t<decltype(std::span<const std::byte>{std::declval<const T&>().available_data()})>>
+		: std::true_type {};
+template <class T>
+inline constexpr bool has_available_data_member_v = has_available_data_member<T>::value;
+
 template <typename>
 constexpr bool dependent_false = false;
 template <typename>
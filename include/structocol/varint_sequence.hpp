@@ -0,0 +1,350 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_VARINT_SEQUENCE_INCLUDED
+#define STRUCTOCOL_VARINT_SEQUENCE_INCLUDED
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <structocol/scanning.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/type_utilities.hpp>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#define STRUCTOCOL_VARINT_SEQUENCE_SSSE3
+#define STRUCTOCOL_VARINT_SEQUENCE_SSSE3_TARGET
+#elif(defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+// Not enabled for the whole build, therefore the SSSE3 decoder is compiled for it separately and used if the CPU
+// supports it.
+#include <tmmintrin.h>
+#define STRUCTOCOL_VARINT_SEQUENCE_SSSE3
+#define STRUCTOCOL_VARINT_SEQUENCE_SSSE3_RUNTIME_CHECK
+#define STRUCTOCOL_VARINT_SEQUENCE_SSSE3_TARGET __attribute__((target("ssse3")))
+#endif
+
+namespace structocol {
+
+// Sequence of 16, 32 or 64 bit integers (std::uint16_t, std::uint32_t, std::uint64_t or their signed counterparts)
+// that is serialized in a compact variable length encoding designed for fast decoding of long sequences (Stream VByte
+// layout): After the number of elements (as a varint_t), a block of control bytes contains the byte length of each
+// element as a bit field (1 bit per element for 16 bit, 2 bits for 32 bit and 4 bits for 64 bit elements, starting at
+// the least significant bits), followed by a block with the minimal number of bytes (but at least 1) of each element
+// in big endian byte order. Signed elements are stored as their ZigZag mapping (see signed_varint_t), so that values
+// of small magnitude are short regardless of their sign.
+// Separating the lengths from the data allows decoding multiple elements at once with SIMD shuffles, which is done
+// using SSSE3 for 32 bit elements if it is enabled at compile time or, with GCC and Clang on x86, if the CPU supports it.
+// Note that this encoding is not compatible with that of a std::vector<varint_t>.
+template <typename T, typename Alloc = std::allocator<T>>
+class varint_sequence : public std::vector<T, Alloc> {
+	static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool> &&
+						  (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8),
+				  "varint_sequence only supports 16, 32 and 64 bit integer elements.");
+
+public:
+	using std::vector<T, Alloc>::vector;
+};
+
+namespace detail {
+
+// Determines if the SSSE3 decoder of varint_sequence is used.
+inline bool varint_sequence_ssse3_decoding() noexcept {
+#if defined(STRUCTOCOL_VARINT_SEQUENCE_SSSE3_RUNTIME_CHECK)
+	static const bool supported = [] {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("ssse3") != 0;
+	}();
+	return supported;
+#elif defined(STRUCTOCOL_VARINT_SEQUENCE_SSSE3)
+	return true;
+#else
+	return false;
+#endif
+}
+
+template <typename T>
+struct stream_vbyte_codec {
+	static constexpr std::size_t code_bits = sizeof(T) == 2 ? 1 : sizeof(T) == 4 ? 2 : 4;
+	static constexpr std::size_t codes_per_byte = CHAR_BIT / code_bits;
+	static constexpr unsigned code_mask = (1u << code_bits) - 1;
+	using wire_type = std::make_unsigned_t<T>;
+
+	static constexpr wire_type to_wire(T value) noexcept {
+		if constexpr(std::is_signed_v<T>) {
+			return zigzag_encode(value);
+		} else {
+			return value;
+		}
+	}
+	static constexpr T from_wire(wire_type value) noexcept {
+		if constexpr(std::is_signed_v<T>) {
+			return zigzag_decode(value);
+		} else {
+			return value;
+		}
+	}
+
+	static constexpr std::size_t control_bytes(std::size_t count) noexcept {
+		return count / codes_per_byte + (count % codes_per_byte != 0 ? 1 : 0);
+	}
+	static std::size_t value_length(T value) noexcept {
+		return std::max<std::size_t>(1, (std::bit_width(to_wire(value)) + 7) / 8);
+	}
+
+	// Number of data bytes described by the control bytes for count elements.
+	// Returns 0 if a control byte contains an invalid length, which can only occur for 64 bit elements.
+	static std::size_t data_length(std::span<const std::uint8_t> control, std::size_t count) noexcept {
+		std::size_t length = 0;
+		for(std::size_t i = 0; i < count; ++i) {
+			unsigned code = (control[i / codes_per_byte] >> (i % codes_per_byte * code_bits)) & code_mask;
+			if(code >= sizeof(T)) return 0;
+			length += code + 1;
+		}
+		return length;
+	}
+
+	// Writes the control_bytes(values.size()) control bytes for the values.
+	static void encode_control(std::span<const T> values, std::uint8_t* control) noexcept {
+		std::fill_n(control, control_bytes(values.size()), std::uint8_t{0});
+		for(std::size_t i = 0; i < values.size(); ++i) {
+			auto length = value_length(values[i]);
+			control[i / codes_per_byte] |= std::uint8_t((length - 1) << (i % codes_per_byte * code_bits));
+		}
+	}
+	// Writes the data bytes for the values (at most values.size() * sizeof(T)) and returns the end of them.
+	static std::uint8_t* encode_data(std::span<const T> values, std::uint8_t* data) noexcept {
+		for(auto value : values) {
+			auto wire_value = to_wire(value);
+			auto length = value_length(value);
+			for(std::size_t b = 0; b < length; ++b) {
+				*data++ = std::uint8_t(wire_value >> ((length - 1 - b) * CHAR_BIT));
+			}
+		}
+		return data;
+	}
+
+	// The data must have the length determined by data_length for the control bytes.
+	static void decode(std::span<const std::uint8_t> control, std::span<const std::uint8_t> data, T* out,
+					   std::size_t count) noexcept {
+		const std::uint8_t* data_pos = data.data();
+		std::size_t i = 0;
+#ifdef STRUCTOCOL_VARINT_SEQUENCE_SSSE3
+		if constexpr(sizeof(T) == 4) {
+			if(varint_sequence_ssse3_decoding()) i = decode_ssse3(control, data, out, count, data_pos);
+		}
+#endif
+		for(; i < count; ++i) {
+			unsigned code = (control[i / codes_per_byte] >> (i % codes_per_byte * code_bits)) & code_mask;
+			wire_type value = 0;
+			for(unsigned b = 0; b <= code; ++b) {
+				value = wire_type((value << CHAR_BIT) | *data_pos++);
+			}
+			out[i] = from_wire(value);
+		}
+	}
+
+private:
+#ifdef STRUCTOCOL_VARINT_SEQUENCE_SSSE3
+	// For each control byte (describing 4 elements of 32 bits), the shuffle mask that moves their big endian data
+	// bytes to the native little endian positions in a 16 byte vector, and the total length of their data.
+	struct shuffle_table {
+		std::array<std::array<std::uint8_t, 16>, 256> masks{};
+		std::array<std::uint8_t, 256> lengths{};
+	};
+	static constexpr shuffle_table make_shuffle_table() {
+		shuffle_table table;
+		for(unsigned control = 0; control < 256; ++control) {
+			unsigned offset = 0;
+			for(unsigned elem = 0; elem < 4; ++elem) {
+				unsigned length = ((control >> (elem * 2)) & 0b11) + 1;
+				for(unsigned b = 0; b < 4; ++b) {
+					table.masks[control][elem * 4 + b] = b < length ? std::uint8_t(offset + length - 1 - b) : 0x80;
+				}
+				offset += length;
+			}
+			table.lengths[control] = std::uint8_t(offset);
+		}
+		return table;
+	}
+	static constexpr shuffle_table table = make_shuffle_table();
+
+	// Decodes groups of 4 elements, as long as 16 bytes can be loaded from the data, and returns the number of
+	// decoded elements.
+	STRUCTOCOL_VARINT_SEQUENCE_SSSE3_TARGET static std::size_t decode_ssse3(std::span<const std::uint8_t> control, std::span<const std::uint8_t> data, T* out,
+									std::size_t count, const std::uint8_t*& data_pos) noexcept {
+		const std::uint8_t* data_end = data.data() + data.size();
+		std::size_t i = 0;
+		for(; i + 4 <= count && data_end - data_pos >= 16; i += 4) {
+			auto control_byte = control[i / 4];
+			auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data_pos));
+			auto mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table.masks[control_byte].data()));
+			auto values = _mm_shuffle_epi8(in, mask);
+			if constexpr(std::is_signed_v<T>) {
+				// ZigZag decoding: (value >> 1) ^ -(value & 1)
+				auto sign = _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(values, _mm_set1_epi32(1)));
+				values = _mm_xor_si128(_mm_srli_epi32(values, 1), sign);
+			}
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), values);
+			data_pos += table.lengths[control_byte];
+		}
+		return i;
+	}
+#endif
+};
+
+// Provides the given number of bytes from the buffer as a contiguous region, directly from the buffer storage if the
+// buffer supports read_view, or otherwise read into scratch.
+template <typename Buff>
+std::span<const std::uint8_t> read_contiguous(Buff& buffer, std::size_t bytes, std::vector<std::uint8_t>& scratch) {
+	if constexpr(has_read_view_member_v<Buff>) {
+		static_cast<void>(scratch);
+		auto view = buffer.read_view(bytes);
+		return {reinterpret_cast<const std::uint8_t*>(view.data()), view.size()};
+	} else {
+		scratch.clear();
+		bulk_read_append(buffer, scratch, bytes);
+		return scratch;
+	}
+}
+
+} // namespace detail
+
+template <typename T, typename Alloc>
+struct serializer<varint_sequence<T, Alloc>> {
+	template <typename Buff>
+	static void serialize(Buff& buffer, const varint_sequence<T, Alloc>& val) {
+		varint_serializer::serialize(buffer, val.size());
+		// The control bytes and then the data bytes are encoded in chunks into a scratch block on the stack.
+		std::array<std::uint8_t, detail::bulk_block_size> chunk;
+		std::span<const T> values(val);
+		constexpr std::size_t control_chunk_elements = chunk.size() * codec::codes_per_byte;
+		for(std::size_t i = 0; i < values.size(); i += control_chunk_elements) {
+			auto part = values.subspan(i, std::min(control_chunk_elements, values.size() - i));
+			codec::encode_control(part, chunk.data());
+			detail::bulk_write(buffer, chunk.data(), codec::control_bytes(part.size()));
+		}
+		constexpr std::size_t data_chunk_elements = chunk.size() / sizeof(T);
+		for(std::size_t i = 0; i < values.size(); i += data_chunk_elements) {
+			auto part = values.subspan(i, std::min(data_chunk_elements, values.size() - i));
+			auto data_end = codec::encode_data(part, chunk.data());
+			detail::bulk_write(buffer, chunk.data(), std::size_t(data_end - chunk.data()));
+		}
+	}
+	template <typename Buff>
+	static varint_sequence<T, Alloc> deserialize(Buff& buffer) {
+		auto val = detail::make_empty_container<varint_sequence<T, Alloc>>(buffer);
+		deserialize_into(buffer, val);
+		return val;
+	}
+	template <typename Buff>
+	static void deserialize_into(Buff& buffer, varint_sequence<T, Alloc>& val) {
+		auto count = varint_serializer::deserialize(buffer);
+		val.clear();
+		detail::container_scope scope(buffer, count, sizeof(T));
+		if(!scope.admitted()) return;
+		std::vector<std::uint8_t> control_scratch;
+		std::vector<std::uint8_t> data_scratch;
+		auto control = detail::read_contiguous(buffer, codec::control_bytes(count), control_scratch);
+		auto data_length = checked_data_length(buffer, control, count);
+		if(detail::deserialization_failed(buffer)) return;
+		auto data = detail::read_contiguous(buffer, data_length, data_scratch);
+		if(detail::deserialization_failed(buffer)) return;
+		// All data are available now, so the count is known to be plausible.
+		val.resize(count);
+		codec::decode(control, data, val.data(), count);
+	}
+	template <typename Buff>
+	static void skip(Buff& buffer) {
+		auto count = varint_serializer::deserialize(buffer);
+		std::vector<std::uint8_t> scratch;
+		auto control = detail::read_contiguous(buffer, codec::control_bytes(count), scratch);
+		auto data_length = checked_data_length(buffer, control, count);
+		if(detail::deserialization_failed(buffer)) return;
+		detail::skip_bytes(buffer, data_length);
+	}
+	template <typename Buff>
+	static void validate(Buff& buffer) {
+		skip(buffer);
+	}
+	static std::size_t size(const varint_sequence<T, Alloc>& val) {
+		std::size_t data_length = 0;
+		for(auto v : val) {
+			data_length += codec::value_length(v);
+		}
+		return varint_serializer::size(val.size()) + codec::control_bytes(val.size()) + data_length;
+	}
+
+private:
+	using codec = detail::stream_vbyte_codec<T>;
+
+	template <typename Buff>
+	static std::size_t checked_data_length(Buff& buffer, std::span<const std::uint8_t> control, std::size_t count) {
+		if(detail::deserialization_failed(buffer)) return 0;
+		auto data_length = codec::data_length(control, count);
+		if(data_length == 0 && count > 0) {
+			detail::report_data_error(buffer, "Invalid element length in varint_sequence.");
+		}
+		return data_length;
+	}
+};
+
+namespace detail {
+
+template <typename T, typename Alloc>
+struct min_size_helper<varint_sequence<T, Alloc>> {
+	static constexpr std::size_t value() {
+		// Length field
+		return 1;
+	}
+};
+
+template <typename T, typename Alloc>
+struct scanner<varint_sequence<T, Alloc>> {
+	static scan_frame make_frame() {
+		return scan_frame{&step};
+	}
+
+private:
+	using codec = stream_vbyte_codec<T>;
+
+	// Phase 0 reads the element count, phase 1 sums up the data lengths from the control bytes into frame.value while
+	// frame.count holds the number of elements whose length wasn't looked at yet. Then the frame is replaced by
+	// skipping the data.
+	static scan_result step(scan_state& state, std::size_t frame_index) {
+		auto& frame = state.frames[frame_index];
+		if(frame.phase == 0) {
+			if(!scan_varint(state, frame)) return scan_result::need_more;
+			frame.phase = 1;
+			frame.count = frame.value;
+			frame.value = 0;
+		}
+		while(frame.count > 0) {
+			if(state.remaining() == 0) return scan_result::need_more;
+			auto control = state.next_byte();
+			auto codes = std::min(frame.count, codec::codes_per_byte);
+			auto length = codec::data_length(std::span(&control, 1), codes);
+			if(length == 0) throw deserialization_data_error("Invalid element length in varint_sequence.");
+			frame.value += length;
+			frame.count -= codes;
+		}
+		frame = make_skip_frame(frame.value);
+		return scan_skip_step(state, frame_index);
+	}
+};
+
+} // namespace detail
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_VARINT_SEQUENCE_INCLUDED
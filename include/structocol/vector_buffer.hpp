@@ -12,6 +12,7 @@
 #include <cassert>
 #include <cstddef>
 #include <optional>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -99,8 +100,50 @@ public:
 		return ret;
 	}
 
+	void read_into(std::span<std::byte> data) {
+		if(!try_read_into(data)) throw buffer_length_error("Not enough bytes left in buffer.");
+	}
+
+	bool try_read_into(std::span<std::byte> data) {
+		if(data.size() > available_bytes()) return false;
+		auto start = raw_vector_.begin() + read_offset_;
+		std::copy(start, start + data.size(), data.begin());
+		read_offset_ += data.size();
+		return true;
+	}
+
+	// Reads the given number of bytes without copying them, returning a view of them in the storage of the buffer.
+	// The view remains valid during further reads, but is invalidated by writing to, trimming or clearing the buffer.
+	std::span<const std::byte> read_view(std::size_t bytes) {
+		auto view = try_read_view(bytes);
+		if(!view) throw buffer_length_error("Not enough bytes left in buffer.");
+		return *view;
+	}
+
+	std::optional<std::span<const std::byte>> try_read_view(std::size_t bytes) {
+		if(bytes > available_bytes()) return std::nullopt;
+		std::span<const std::byte> view(raw_vector_.data() + read_offset_, bytes);
+		read_offset_ += bytes;
+		return view;
+	}
+
+	// Consumes the given number of bytes without reading them.
+	void skip(std::size_t bytes) {
+		if(!try_skip(bytes)) throw buffer_length_error("Not enough bytes left in buffer.");
+	}
+
+	bool try_skip(std::size_t bytes) noexcept {
+		if(bytes > available_bytes()) return false;
+		read_offset_ += bytes;
+		return true;
+	}
+
 	template <std::size_t bytes>
 	void write(const std::array<std::byte, bytes>& data) {
+		write(std::span<const std::byte>(data));
+	}
+
+	void write(std::span<const std::byte> data) {
 #ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
 		assert(raw_vector_.size() == size_ &&
 			   "write MUST NOT be called when there are prepare()d but not commit()ed writes.");
@@ -144,6 +187,12 @@ public:
 		raw_vector_.reserve(raw_vector_.size() + writable_capacity);
 	}
 
+	// The bytes available for reading, as a contiguous memory region.
+	// Invalidated by all non-const operations on the buffer.
+	std::span<const std::byte> available_data() const noexcept {
+		return std::span<const std::byte>(raw_vector_.data() + read_offset_, available_bytes());
+	}
+
 	std::size_t available_bytes() const noexcept {
 #ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
 		return size_ - read_offset_;
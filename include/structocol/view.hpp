@@ -0,0 +1,145 @@
+/*
+ * Structocol project
+ *
+ * Copyright 2026
+ */
+
+#ifndef STRUCTOCOL_VIEW_INCLUDED
+#define STRUCTOCOL_VIEW_INCLUDED
+
+#include "exceptions.hpp"
+#include <array>
+#include <cstddef>
+#include <span>
+#include <structocol/serialization.hpp>
+#include <structocol/span_buffer.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace structocol {
+
+// Read-only view of the serialized representation of an aggregate T, that decodes individual fields on demand
+// instead of deserializing the whole object.
+// The offset of a field is determined when it is first needed: The offsets of the fixed-size fields at the start of T
+// are compile-time constants. Beyond that, the preceding variable-length fields are skipped using structocol::skip,
+// which only looks at their length fields and not at their content, if their elements have a fixed size. Accessing
+// fields doesn't allocate memory, except for the decoded values themselves. Determined offsets are cached in the view,
+// therefore a view object must not be used concurrently.
+// Fields of borrowed view types (e.g. std::string_view) refer directly to the viewed data.
+// The viewed data must outlive the view and the values of borrowed view types obtained from it.
+template <typename T>
+class view {
+	static_assert(std::is_aggregate_v<T> && std::is_base_of_v<detail::general_serializer<T>, serializer<T>>,
+				  "view is only supported for aggregates using the built-in serializer.");
+
+public:
+	static constexpr std::size_t field_count = boost::pfr::tuple_size_v<T>;
+	template <std::size_t index>
+	using field_type = boost::pfr::tuple_element_t<index, T>;
+
+	// data must begin with the serialized representation of a T, but may extend beyond it.
+	explicit view(std::span<const std::byte> data) noexcept : data_{data} {}
+
+	// Decodes the field with the given index.
+	template <std::size_t index>
+	field_type<index> get() const {
+		span_read_buffer reader(data_from(offset(index)));
+		return structocol::deserialize<field_type<index>>(reader);
+	}
+
+	// Provides a view of a field that is itself an aggregate, to access only parts of it.
+	template <std::size_t index>
+	view<field_type<index>> get_view() const {
+		return view<field_type<index>>(data_from(offset(index)));
+	}
+
+	// The serialized representation of the field with the given index.
+	template <std::size_t index>
+	std::span<const std::byte> field_data() const {
+		auto begin = offset(index);
+		auto end = offset(index + 1);
+		return data_.subspan(begin, end - begin);
+	}
+
+	// The length of the serialized representation of the whole T.
+	std::size_t serialized_size() const {
+		return offset(field_count);
+	}
+
+	// The serialized representation of the whole T.
+	std::span<const std::byte> data() const {
+		return data_.first(serialized_size());
+	}
+
+	// Decodes the whole T.
+	T deserialize() const {
+		span_read_buffer reader(data_);
+		return structocol::deserialize<T>(reader);
+	}
+
+private:
+	using field_size_fn = std::size_t (*)(std::span<const std::byte>);
+	using offset_array = std::array<std::size_t, field_count + 1>;
+
+	template <typename F>
+	static constexpr std::size_t field_size(std::span<const std::byte> data) {
+		if constexpr(has_fixed_serialized_size_v<F>) {
+			static_cast<void>(data);
+			return structocol::serialized_size<F>();
+		} else {
+			// skip doesn't allocate, unlike the resumable scanner, and throws buffer_length_error on truncated data.
+			span_read_buffer reader(data);
+			structocol::skip<F>(reader);
+			return data.size() - reader.available_bytes();
+		}
+	}
+	template <std::size_t... indseq>
+	static constexpr auto make_field_sizers(std::index_sequence<indseq...>) {
+		return std::array<field_size_fn, field_count>{&field_size<field_type<indseq>>...};
+	}
+	static constexpr std::array<field_size_fn, field_count> field_sizers =
+			make_field_sizers(std::make_index_sequence<field_count>{});
+
+	template <std::size_t... indseq>
+	static constexpr std::size_t count_fixed_prefix(std::index_sequence<indseq...>) {
+		std::size_t count = 0;
+		bool fixed = true;
+		((fixed = fixed && has_fixed_serialized_size_v<field_type<indseq>>, count += fixed ? 1 : 0), ...);
+		return count;
+	}
+	// Number of fields at the start of T with a fixed size, for which the offsets are known at compile time.
+	static constexpr std::size_t fixed_prefix_fields = count_fixed_prefix(std::make_index_sequence<field_count>{});
+
+	template <std::size_t... indseq>
+	static constexpr offset_array make_fixed_prefix_offsets(std::index_sequence<indseq...>) {
+		offset_array offsets{};
+		((offsets[indseq + 1] = offsets[indseq] + field_size<field_type<indseq>>({})), ...);
+		return offsets;
+	}
+	static constexpr offset_array fixed_prefix_offsets =
+			make_fixed_prefix_offsets(std::make_index_sequence<fixed_prefix_fields>{});
+
+	std::span<const std::byte> data_;
+	mutable offset_array offsets_ = fixed_prefix_offsets;
+	// Number of entries in offsets_ that were already determined.
+	mutable std::size_t known_offsets_ = fixed_prefix_fields + 1;
+
+	std::size_t offset(std::size_t index) const {
+		for(; known_offsets_ <= index; ++known_offsets_) {
+			auto prev = offsets_[known_offsets_ - 1];
+			offsets_[known_offsets_] = prev + field_sizers[known_offsets_ - 1](data_from(prev));
+		}
+		// The offsets in the fixed-size prefix and the ends of fixed-size fields are not derived from the data.
+		if(offsets_[index] > data_.size()) throw buffer_length_error("Viewed data end before the requested field.");
+		return offsets_[index];
+	}
+
+	std::span<const std::byte> data_from(std::size_t offset) const {
+		if(offset > data_.size()) throw buffer_length_error("Viewed data end before the requested field.");
+		return data_.subspan(offset);
+	}
+};
+
+} // namespace structocol
+
+#endif // STRUCTOCOL_VIEW_INCLUDED
@@ -0,0 +1,9 @@
+// Must fail to compile: incremental_decoder only supports the default wire format.
+#include <cstdint>
+#include <structocol/incremental_decoder.hpp>
+
+int main() {
+	structocol::incremental_decoder<structocol::basic_protocol_handler<structocol::little_endian_format, std::uint32_t>>
+			decoder;
+	return decoder.next().has_value() ? 0 : 1;
+}
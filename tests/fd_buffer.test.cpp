@@ -0,0 +1,131 @@
+#include <structocol/fd_buffer.hpp>
+
+#if __has_include(<unistd.h>) && __has_include(<sys/uio.h>)
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <csignal>
+#include <cstdint>
+#include <fcntl.h>
+#include <string>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <sys/socket.h>
+#include <vector>
+
+namespace {
+struct fd_closer {
+	int fd;
+	~fd_closer() {
+		::close(fd);
+	}
+};
+} // namespace
+
+TEST_CASE("fd_buffer can read back data written to a pipe", "[fd_buffer]") {
+	int fds[2];
+	REQUIRE(::pipe(fds) == 0);
+	fd_closer read_end{fds[0]};
+	std::vector<std::byte> data(5000);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte(b += 3); });
+	{
+		fd_closer write_end{fds[1]};
+		structocol::fd_buffer ob(write_end.fd, 16);
+		for(std::size_t i = 0; i < 100; ++i) {
+			ob.write(std::array{data[i]});
+		}
+		// Each write not fitting into the block is passed to writev() together with the collected data.
+		CHECK(ob.pending_bytes() == 15);
+		ob.write(std::span<const std::byte>(data).subspan(100));
+		CHECK(ob.pending_bytes() == 0);
+		ob.flush();
+	}
+	structocol::fd_buffer ib(read_end.fd, 16);
+	for(std::size_t i = 0; i < 100; ++i) {
+		REQUIRE(ib.read<1>().front() == data[i]);
+	}
+	ib.skip(1000);
+	std::vector<std::byte> read_back(3900);
+	ib.read_into(read_back);
+	CHECK(std::equal(read_back.begin(), read_back.end(), data.begin() + 1100));
+	CHECK(!ib.try_read<1>().has_value());
+	CHECK_THROWS_AS(ib.read<1>(), std::runtime_error);
+}
+
+TEST_CASE("fd_buffer writes queued messages to a file in one gather operation", "[fd_buffer]") {
+	int fd = ::open("test_file.temp", O_RDWR | O_CREAT | O_TRUNC, 0600);
+	REQUIRE(fd >= 0);
+	fd_closer closer{fd};
+	std::vector<structocol::vector_buffer<>> messages(10);
+	std::vector<std::span<const std::byte>> chunks;
+	for(std::size_t i = 0; i < messages.size(); ++i) {
+		structocol::serialize(messages[i], "Message " + std::to_string(i));
+		chunks.push_back(messages[i].available_data());
+	}
+	{
+		structocol::fd_buffer ob(fd);
+		structocol::serialize(ob, std::uint32_t(messages.size()));
+		ob.write_gather(chunks);
+		CHECK(ob.pending_bytes() == 0);
+		structocol::serialize(ob, std::string("End"));
+		CHECK(ob.pending_bytes() == 4);
+	}
+	REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+	structocol::fd_buffer ib(fd);
+	auto count = structocol::deserialize<std::uint32_t>(ib);
+	REQUIRE(count == messages.size());
+	for(std::size_t i = 0; i < count; ++i) {
+		CHECK(structocol::deserialize<std::string>(ib) == "Message " + std::to_string(i));
+	}
+	CHECK(structocol::deserialize<std::string>(ib) == "End");
+	CHECK(!ib.try_skip(1));
+}
+
+TEST_CASE("fd_buffer works on both directions of a Unix socket", "[fd_buffer]") {
+	int fds[2];
+	REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+	fd_closer a_end{fds[0]};
+	fd_closer b_end{fds[1]};
+	structocol::fd_buffer a(a_end.fd);
+	structocol::fd_buffer b(b_end.fd);
+	structocol::serialize(a, std::string("ping"));
+	a.flush();
+	CHECK(structocol::deserialize<std::string>(b) == "ping");
+	structocol::serialize(b, std::string("pong"));
+	b.flush();
+	CHECK(structocol::deserialize<std::string>(a) == "pong");
+}
+
+TEST_CASE("Errors on the file descriptor are signalled by fd_buffer", "[fd_buffer]") {
+	SECTION("reading from a write-only file descriptor") {
+		int fd = ::open("test_file.temp", O_WRONLY | O_CREAT | O_TRUNC, 0600);
+		REQUIRE(fd >= 0);
+		fd_closer closer{fd};
+		structocol::fd_buffer ib(fd);
+		CHECK_THROWS_AS(ib.read<1>(), std::runtime_error);
+	}
+	SECTION("flushing to a read-only file descriptor") {
+		int fd = ::open("test_file.temp", O_RDONLY | O_CREAT, 0600);
+		REQUIRE(fd >= 0);
+		fd_closer closer{fd};
+		structocol::fd_buffer ob(fd);
+		ob.write(std::array{std::byte{42}});
+		CHECK_THROWS_AS(ob.flush(), std::runtime_error);
+	}
+	SECTION("writing to a pipe without a reader keeps the collected data pending") {
+		auto previous_handler = std::signal(SIGPIPE, SIG_IGN);
+		int fds[2];
+		REQUIRE(::pipe(fds) == 0);
+		::close(fds[0]);
+		fd_closer write_end{fds[1]};
+		structocol::fd_buffer ob(write_end.fd, 16);
+		ob.write(std::array{std::byte{1}, std::byte{2}, std::byte{3}});
+		CHECK_THROWS_AS(ob.write(std::vector<std::byte>(100)), std::runtime_error);
+		CHECK(ob.pending_bytes() == 3);
+		CHECK_THROWS_AS(ob.flush(), std::runtime_error);
+		CHECK(ob.pending_bytes() == 3);
+		std::signal(SIGPIPE, previous_handler);
+	}
+}
+
+#endif
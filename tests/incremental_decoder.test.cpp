@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <structocol/exceptions.hpp>
+#include <structocol/incremental_decoder.hpp>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/scanning.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+namespace {
+struct point {
+	std::int32_t x;
+	std::int32_t y;
+};
+bool operator==(const point& a, const point& b) {
+	return std::tie(a.x, a.y) == std::tie(b.x, b.y);
+}
+struct shape_msg {
+	std::string name;
+	std::vector<point> points;
+	std::optional<std::map<std::string, std::uint16_t>> attributes;
+	std::variant<std::monostate, std::string, std::vector<std::string>> tag;
+	std::tuple<std::uint8_t, std::string> extra;
+	std::array<std::string, 2> labels;
+	std::vector<structocol::varint_t> ids;
+};
+bool operator==(const shape_msg& a, const shape_msg& b) {
+	return std::tie(a.name, a.points, a.attributes, a.tag, a.extra, a.labels) ==
+				   std::tie(b.name, b.points, b.attributes, b.tag, b.extra, b.labels) &&
+		   std::equal(a.ids.begin(), a.ids.end(), b.ids.begin(), b.ids.end(),
+					  [](const auto& x, const auto& y) { return x.value == y.value; });
+}
+struct text_msg {
+	std::u16string text;
+};
+bool operator==(const text_msg& a, const text_msg& b) {
+	return a.text == b.text;
+}
+
+std::vector<shape_msg> make_shapes() {
+	return {shape_msg{"triangle", {{0, 0}, {10, 0}, {5, 8}}, std::nullopt, std::monostate{}, {1, "a"}, {"x", "y"}, {5}},
+			shape_msg{"square",
+					  {{0, 0}, {4, 0}, {4, 4}, {0, 4}},
+					  std::map<std::string, std::uint16_t>{{"color", 3}, {"width", 2}},
+					  std::string("important"),
+					  {2, ""},
+					  {"", "long label text"},
+					  {300, 0, 1u << 20}},
+			shape_msg{std::string(1000, 'n'), std::vector<point>(500, point{-1, 1}), std::nullopt,
+					  std::vector<std::string>{"a", "b", std::string(200, 'c')}, {3, "extra"}, {"1", "2"}, {0x12345678}}};
+}
+} // namespace
+
+TEST_CASE("scan_serialized_size determines the same size as serialized_size", "[incremental_decoder]") {
+	for(const auto& shape : make_shapes()) {
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, shape);
+		auto expected = structocol::serialized_size(shape);
+		auto data = vb.available_data();
+		CHECK(structocol::scan_serialized_size<shape_msg>(data) == expected);
+		CHECK(!structocol::scan_serialized_size<shape_msg>(data.first(expected - 1)).has_value());
+	}
+}
+
+TEST_CASE("scan_serialized_size supports borrowed views", "[incremental_decoder]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, std::tuple<std::string_view, std::uint8_t>("abc", 1));
+	CHECK(structocol::scan_serialized_size<std::tuple<std::string_view, std::uint8_t>>(vb.available_data()) == 5);
+}
+
+TEST_CASE("scan_serialized_size supports bit-packed std::vector<bool>", "[incremental_decoder]") {
+	structocol::vector_buffer vb;
+	std::tuple<std::vector<bool>, std::uint8_t> val{std::vector<bool>(1001, true), 1};
+	structocol::serialize(vb, val);
+	CHECK(structocol::scan_serialized_size<decltype(val)>(vb.available_data()) == 2 + 126 + 1);
+}
+
+TEST_CASE("serialized_size_scanner can be resumed at every byte", "[incremental_decoder]") {
+	auto shapes = make_shapes();
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, shapes[1]);
+	auto data = vb.available_data();
+	structocol::serialized_size_scanner<shape_msg> scanner;
+	for(std::size_t i = 0; i < data.size(); ++i) {
+		REQUIRE(!scanner.resume(data.first(i)).has_value());
+	}
+	CHECK(scanner.resume(data) == data.size());
+}
+
+TEST_CASE("incremental_decoder yields messages as soon as they are complete, regardless of chunking",
+		  "[incremental_decoder]") {
+	auto shapes = make_shapes();
+	structocol::vector_buffer vb;
+	for(const auto& shape : shapes) {
+		structocol::serialize(vb, shape);
+	}
+	auto data = vb.available_data();
+	auto chunk_size = GENERATE(as<std::size_t>{}, 1, 2, 3, 7, 64, 1000, 100000);
+	structocol::incremental_decoder<shape_msg> decoder;
+	std::vector<shape_msg> received;
+	std::size_t pos = 0;
+	std::size_t next_message_end = structocol::serialized_size(shapes[0]);
+	while(pos < data.size()) {
+		auto n = std::min(chunk_size, data.size() - pos);
+		decoder.feed(data.subspan(pos, n));
+		pos += n;
+		while(auto msg = decoder.next()) {
+			// Must not be produced before its last byte was fed, but immediately after it.
+			CHECK(pos >= next_message_end);
+			CHECK(pos < next_message_end + chunk_size);
+			received.push_back(std::move(*msg));
+			if(received.size() < shapes.size()) {
+				next_message_end += structocol::serialized_size(shapes[received.size()]);
+			}
+		}
+	}
+	CHECK(decoder.buffered_bytes() == 0);
+	CHECK(received == shapes);
+}
+
+TEST_CASE("incremental_decoder for protocol_handler decodes messages fed in chunks", "[incremental_decoder]") {
+	using ph = structocol::protocol_handler<shape_msg, text_msg>;
+	using msg_t = ph::any_message_t;
+	auto shapes = make_shapes();
+	std::vector<msg_t> msgs{shapes[0], text_msg{u"Hello"}, shapes[2], text_msg{u""}, shapes[1]};
+	structocol::vector_buffer vb;
+	for(const auto& m : msgs) {
+		std::visit([&vb](const auto& msg) { ph::encode_message(vb, msg); }, m);
+	}
+	auto data = vb.available_data();
+	structocol::incremental_decoder<ph> decoder;
+	std::vector<msg_t> decoded;
+	std::vector<msg_t> processed;
+	for(std::size_t pos = 0; pos < data.size(); pos += 5) {
+		decoder.feed(data.subspan(pos, std::min<std::size_t>(5, data.size() - pos)));
+		if(decoded.size() <= processed.size()) {
+			if(auto msg = decoder.next()) decoded.push_back(*msg);
+		} else {
+			decoder.process_next([&processed](const auto& m) { processed.push_back(m); });
+		}
+	}
+	while(auto msg = decoder.next()) decoded.push_back(*msg);
+	decoded.insert(decoded.end(), processed.begin(), processed.end());
+	CHECK(decoded.size() == msgs.size());
+	CHECK(decoder.buffered_bytes() == 0);
+}
+
+TEST_CASE("incremental_decoder reports invalid data", "[incremental_decoder]") {
+	using ph = structocol::protocol_handler<shape_msg, text_msg>;
+	structocol::incremental_decoder<ph> decoder;
+	decoder.feed(std::array{std::byte{7}, std::byte{0}});
+	CHECK_THROWS_AS(decoder.next(), structocol::deserialization_data_error);
+	decoder.reset();
+	CHECK(decoder.buffered_bytes() == 0);
+	structocol::vector_buffer vb;
+	ph::encode_message(vb, text_msg{u"Test"});
+	decoder.feed(vb.available_data());
+	auto msg = decoder.next();
+	REQUIRE(msg.has_value());
+	CHECK(std::get<text_msg>(*msg) == text_msg{u"Test"});
+}
@@ -0,0 +1,79 @@
+#include <structocol/mmap_buffer.hpp>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <structocol/serialization.hpp>
+#include <structocol/stdio_buffer.hpp>
+#include <vector>
+
+namespace {
+struct archived_message {
+	std::uint64_t timestamp;
+	std::string_view text;
+	std::vector<std::uint16_t> values;
+};
+
+void write_test_file(std::size_t messages) {
+	std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "wb"),
+																	[](std::FILE* f) { std::fclose(f); }};
+	structocol::stdio_buffer buffer(file_handle.get());
+	for(std::size_t i = 0; i < messages; ++i) {
+		structocol::serialize(buffer, std::uint64_t(i));
+		structocol::serialize(buffer, "Message " + std::to_string(i));
+		structocol::serialize(buffer, std::vector<std::uint16_t>(i % 7, std::uint16_t(i)));
+	}
+}
+} // namespace
+
+TEST_CASE("mmap_buffer reads back the data of a file", "[mmap_buffer]") {
+	write_test_file(1000);
+	structocol::mmap_buffer buffer(std::string("test_file.temp"));
+	auto file_size = buffer.size();
+	CHECK(buffer.available_bytes() == file_size);
+	auto mapped = buffer.available_data();
+	auto mapped_begin = reinterpret_cast<const char*>(mapped.data());
+	for(std::size_t i = 0; i < 1000; ++i) {
+		auto msg = structocol::deserialize<archived_message>(buffer);
+		REQUIRE(msg.timestamp == i);
+		REQUIRE(msg.text == "Message " + std::to_string(i));
+		REQUIRE(msg.values == std::vector<std::uint16_t>(i % 7, std::uint16_t(i)));
+		// Borrowed views refer directly to the mapped file.
+		REQUIRE(msg.text.data() >= mapped_begin);
+		REQUIRE(msg.text.data() + msg.text.size() <= mapped_begin + mapped.size());
+	}
+	CHECK(buffer.available_bytes() == 0);
+	CHECK(!buffer.try_read<1>().has_value());
+	CHECK_THROWS_AS(buffer.read<1>(), structocol::buffer_length_error);
+	buffer.seek(0);
+	CHECK(structocol::deserialize<std::uint64_t>(buffer) == 0);
+	CHECK_THROWS_AS(buffer.seek(file_size + 1), structocol::buffer_length_error);
+}
+
+TEST_CASE("mmap_buffer keeps the mapping when moved", "[mmap_buffer]") {
+	write_test_file(10);
+	structocol::mmap_buffer buffer(std::string("test_file.temp"));
+	auto first = structocol::deserialize<archived_message>(buffer);
+	structocol::mmap_buffer moved(std::move(buffer));
+	CHECK(buffer.available_bytes() == 0);
+	CHECK(first.text == "Message 0");
+	CHECK(structocol::deserialize<archived_message>(moved).text == "Message 1");
+	moved.skip(moved.available_bytes());
+	CHECK(!moved.try_skip(1));
+}
+
+TEST_CASE("mmap_buffer handles empty and missing files", "[mmap_buffer]") {
+	write_test_file(0);
+	structocol::mmap_buffer buffer(std::string("test_file.temp"));
+	CHECK(buffer.size() == 0);
+	CHECK(buffer.available_data().empty());
+	CHECK(!buffer.try_read<1>().has_value());
+	CHECK_THROWS_AS(structocol::mmap_buffer(std::string("nonexistent_dir/test_file.temp")), structocol::io_error);
+}
+
+#endif
@@ -1,8 +1,14 @@
+#include <array>
 #include <catch2/catch_all.hpp>
 #include <map>
+#include <memory_resource>
 #include <string>
+#include <string_view>
+#include <structocol/error_code.hpp>
 #include <structocol/protocol_handler.hpp>
 #include <structocol/vector_buffer.hpp>
+#include <system_error>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -68,3 +74,187 @@ TEST_CASE("protocol handler message stream arrives (using process_message) as it
 	}
 	REQUIRE(msg_seq_proc == msg_seq);
 }
+
+TEST_CASE("protocol handler reserves the required buffer capacity in advance when encoding", "[protocol_handler]") {
+	structocol::protocol_handler<hello_msg, lobby_msg, enter_result_msg, score_board_msg> ph;
+	lobby_msg msg{std::vector<std::string>(100, "Some User Name")};
+	structocol::vector_buffer vb;
+	ph.encode_message(vb, msg);
+	CHECK(vb.available_bytes() == ph.calculate_message_size(msg));
+	CHECK(vb.total_capacity() == ph.calculate_message_size(msg));
+	auto decoded = ph.decode_message(vb);
+	CHECK(std::get<lobby_msg>(decoded) == msg);
+}
+
+TEST_CASE("protocol handler reports errors via error code when using the non-throwing functions", "[protocol_handler]") {
+	using ph = structocol::protocol_handler<hello_msg, lobby_msg, enter_result_msg, score_board_msg>;
+	structocol::vector_buffer vb;
+	ph::encode_message(vb, enter_result_msg{"John Doe", 9001});
+	structocol::vector_buffer truncated;
+	truncated.write(vb.available_data().first(vb.available_bytes() - 1));
+	structocol::serialize(vb, std::uint8_t{4});
+	ph::encode_message(vb, hello_msg{"Jane Smith"});
+
+	std::error_code ec;
+	auto msg = ph::try_decode_message(vb, ec);
+	CHECK(!ec);
+	REQUIRE(msg.has_value());
+	CHECK(std::get<enter_result_msg>(*msg) == enter_result_msg{"John Doe", 9001});
+	CHECK(!ph::try_decode_message(vb, ec).has_value());
+	CHECK(ec == structocol::errc::invalid_data);
+	bool called = false;
+	CHECK(ph::try_process_message(vb, [&called](const auto&) { called = true; }, ec));
+	CHECK(!ec);
+	CHECK(called);
+
+	called = false;
+	CHECK(!ph::try_process_message(truncated, [&called](const auto&) { called = true; }, ec));
+	CHECK(ec == structocol::errc::insufficient_data);
+	CHECK(!called);
+}
+
+namespace {
+struct hello_view_msg {
+	std::string_view name;
+};
+struct lobby_view_msg {
+	std::vector<std::string_view> users;
+};
+} // namespace
+
+TEST_CASE("protocol handler can process messages with views borrowing from the buffer", "[protocol_handler]") {
+	structocol::protocol_handler<hello_msg, lobby_msg> ph_send;
+	structocol::protocol_handler<hello_view_msg, lobby_view_msg> ph_recv;
+	structocol::vector_buffer vb;
+	ph_send.encode_message(vb, hello_msg{"John Doe"});
+	ph_send.encode_message(vb, lobby_msg{{"John Doe", "Jane Smith"}});
+	std::vector<std::string> received;
+	for(int i = 0; i < 2; ++i) {
+		ph_recv.process_message(vb, [&received](const auto& m) {
+			if constexpr(std::is_same_v<std::decay_t<decltype(m)>, hello_view_msg>) {
+				received.emplace_back(m.name);
+			} else {
+				received.insert(received.end(), m.users.begin(), m.users.end());
+			}
+		});
+	}
+	CHECK(received == std::vector<std::string>{"John Doe", "John Doe", "Jane Smith"});
+}
+
+TEST_CASE("protocol handler can skip and validate messages without decoding them", "[protocol_handler]") {
+	using ph = structocol::protocol_handler<hello_msg, lobby_msg, enter_result_msg, score_board_msg>;
+	structocol::vector_buffer vb;
+	ph::encode_message(vb, lobby_msg{{"John Doe", "Jane Smith"}});
+	ph::encode_message(vb, score_board_msg{{{"John Doe", 9001}}});
+	ph::encode_message(vb, hello_msg{"John Doe"});
+	CHECK(ph::skip_message(vb) == 1);
+	CHECK(ph::validate_message(vb) == 3);
+	CHECK(std::get<hello_msg>(ph::decode_message(vb)) == hello_msg{"John Doe"});
+	CHECK(vb.available_bytes() == 0);
+	structocol::serialize(vb, std::uint8_t{4});
+	CHECK_THROWS_AS(ph::skip_message(vb), structocol::deserialization_data_error);
+}
+
+TEST_CASE("protocol handler enforces decode limits on messages", "[protocol_handler]") {
+	using ph = structocol::protocol_handler<hello_msg, lobby_msg, enter_result_msg, score_board_msg>;
+	structocol::decode_limits limits;
+	limits.max_elements = 16;
+	structocol::vector_buffer vb;
+	ph::encode_message(vb, hello_msg{"John Doe"});
+	ph::encode_message(vb, lobby_msg{{"John Doe", "Jane Smith"}});
+	ph::encode_message(vb, lobby_msg{std::vector<std::string>(17, "x")});
+
+	CHECK(std::get<hello_msg>(ph::decode_message(vb, limits)) == hello_msg{"John Doe"});
+	bool called = false;
+	std::error_code ec;
+	CHECK(ph::try_process_message(vb, [&called](const auto&) { called = true; }, ec, limits));
+	CHECK(called);
+	called = false;
+	CHECK(!ph::try_process_message(vb, [&called](const auto&) { called = true; }, ec, limits));
+	CHECK(ec == structocol::errc::limit_exceeded);
+	CHECK(!called);
+
+	vb.clear();
+	ph::encode_message(vb, hello_msg{"Jane Smith, with a very long name"});
+	CHECK_THROWS_AS(ph::decode_message(vb, limits), structocol::decode_limit_error);
+}
+
+namespace {
+struct pmr_hello_msg {
+	std::pmr::string name;
+};
+struct pmr_lobby_msg {
+	std::pmr::vector<std::pmr::string> users;
+};
+} // namespace
+
+TEST_CASE("protocol handler allocates decoded messages from the given memory resource", "[protocol_handler]") {
+	using ph = structocol::protocol_handler<pmr_hello_msg, pmr_lobby_msg>;
+	structocol::vector_buffer vb;
+	std::pmr::string long_name(64, 'x');
+	ph::encode_message(vb, pmr_hello_msg{long_name});
+	ph::encode_message(vb, pmr_lobby_msg{{long_name, long_name}});
+
+	std::array<std::byte, 1024> arena_storage;
+	std::pmr::monotonic_buffer_resource arena(arena_storage.data(), arena_storage.size(),
+											  std::pmr::null_memory_resource());
+	auto msg = ph::decode_message(vb, arena);
+	CHECK(std::get<pmr_hello_msg>(msg).name == long_name);
+	CHECK(std::get<pmr_hello_msg>(msg).name.get_allocator().resource() == &arena);
+	bool called = false;
+	ph::process_message(
+			vb,
+			[&](const auto& m) {
+				if constexpr(std::is_same_v<std::decay_t<decltype(m)>, pmr_lobby_msg>) {
+					called = true;
+					CHECK(m.users.size() == 2);
+					CHECK(m.users.get_allocator().resource() == &arena);
+					CHECK(m.users.back().get_allocator().resource() == &arena);
+				}
+			},
+			arena);
+	CHECK(called);
+}
+
+TEMPLATE_TEST_CASE("protocol handler encodes and decodes messages in the wire format of its policy",
+				   "[protocol_handler][format_policy]", structocol::little_endian_format, structocol::varint_format) {
+	using ph = structocol::basic_protocol_handler<TestType, hello_msg, lobby_msg, enter_result_msg, score_board_msg>;
+	structocol::vector_buffer vb;
+	score_board_msg scores{{{"John Doe", 9001}, {"Jane Smith", 10000}}};
+	ph::encode_message(vb, enter_result_msg{"John Doe", 9001});
+	CHECK(vb.available_bytes() == ph::calculate_message_size(enter_result_msg{"John Doe", 9001}));
+	ph::encode_message(vb, scores);
+	ph::encode_message(vb, hello_msg{"John Doe"});
+	ph::encode_message(vb, lobby_msg{std::vector<std::string>(17, "x")});
+
+	CHECK(std::get<enter_result_msg>(ph::decode_message(vb)) == enter_result_msg{"John Doe", 9001});
+	bool called = false;
+	ph::process_message(vb, [&](const auto& m) {
+		if constexpr(std::is_same_v<std::decay_t<decltype(m)>, score_board_msg>) {
+			called = true;
+			CHECK(m == scores);
+		}
+	});
+	CHECK(called);
+	CHECK(ph::validate_message(vb) == 0);
+	structocol::decode_limits limits;
+	limits.max_elements = 16;
+	std::error_code ec;
+	CHECK(!ph::try_decode_message(vb, ec, limits).has_value());
+	CHECK(ec == structocol::errc::limit_exceeded);
+}
+
+TEST_CASE("protocol handlers with different wire formats produce different encodings",
+		  "[protocol_handler][format_policy]") {
+	using big_endian_ph = structocol::protocol_handler<hello_msg, enter_result_msg>;
+	using little_endian_ph =
+			structocol::basic_protocol_handler<structocol::little_endian_format, hello_msg, enter_result_msg>;
+	structocol::vector_buffer big_endian_vb;
+	structocol::vector_buffer little_endian_vb;
+	big_endian_ph::encode_message(big_endian_vb, enter_result_msg{"John Doe", 9001});
+	little_endian_ph::encode_message(little_endian_vb, enter_result_msg{"John Doe", 9001});
+	CHECK(big_endian_vb.available_bytes() == little_endian_vb.available_bytes());
+	CHECK(big_endian_vb.raw_vector() != little_endian_vb.raw_vector());
+	CHECK(std::get<enter_result_msg>(little_endian_ph::decode_message(little_endian_vb)) ==
+		  enter_result_msg{"John Doe", 9001});
+}
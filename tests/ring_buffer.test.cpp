@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <string>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/ring_buffer.hpp>
+#include <structocol/serialization.hpp>
+#include <vector>
+
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+#include <boost/asio/buffer.hpp>
+#endif
+
+TEST_CASE("ring_buffer can read back data written to it (interleaved)", "[ring_buffer]") {
+	structocol::ring_buffer rb(8);
+	for(std::uint32_t i = 0; i < 100; ++i) {
+		rb.write(std::array{std::byte(i), std::byte(i + 1), std::byte(i + 2)});
+		auto data = rb.read<3>();
+		REQUIRE(data == std::array{std::byte(i), std::byte(i + 1), std::byte(i + 2)});
+	}
+	CHECK(rb.total_capacity() == 8);
+	CHECK(rb.available_bytes() == 0);
+	CHECK(!rb.try_read<1>().has_value());
+	CHECK_THROWS_AS(rb.read<1>(), structocol::buffer_length_error);
+}
+
+TEST_CASE("ring_buffer wraps around without moving data", "[ring_buffer]") {
+	structocol::ring_buffer rb(8);
+	rb.write(std::array{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}, std::byte{5}, std::byte{6}});
+	rb.skip(4);
+	rb.write(std::array{std::byte{7}, std::byte{8}, std::byte{9}, std::byte{10}});
+	CHECK(rb.total_capacity() == 8);
+	auto segments = rb.available_segments();
+	CHECK(segments[0].size() == 4);
+	CHECK(segments[1].size() == 2);
+	CHECK(segments[0][0] == std::byte{5});
+	CHECK(segments[1][1] == std::byte{10});
+	CHECK(rb.writable_capacity() == 2);
+	std::array<std::byte, 6> data;
+	rb.read_into(data);
+	CHECK(data == std::array{std::byte{5}, std::byte{6}, std::byte{7}, std::byte{8}, std::byte{9}, std::byte{10}});
+	CHECK(!rb.try_skip(1));
+}
+
+TEST_CASE("ring_buffer grows when writes exceed the free capacity", "[ring_buffer]") {
+	structocol::ring_buffer rb(4);
+	rb.write(std::array{std::byte{1}, std::byte{2}, std::byte{3}});
+	rb.skip(2);
+	std::vector<std::byte> data(100);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte(b += 3); });
+	rb.write(data);
+	CHECK(rb.total_capacity() >= 101);
+	CHECK(rb.read<1>().front() == std::byte{3});
+	std::vector<std::byte> read_back(100);
+	rb.read_into(read_back);
+	CHECK(read_back == data);
+	rb.reserve(1000);
+	CHECK(rb.writable_capacity() >= 1000);
+}
+
+TEST_CASE("ring_buffer supports serialization and protocol_handler with a steady backlog", "[ring_buffer]") {
+	using handler = structocol::protocol_handler<std::string, std::vector<std::uint32_t>>;
+	structocol::ring_buffer rb;
+	for(std::uint32_t i = 0; i < 10; ++i) {
+		handler::encode_message(rb, std::string("Backlog ") + std::to_string(i));
+	}
+	for(std::uint32_t i = 0; i < 1000; ++i) {
+		handler::encode_message(rb, std::vector<std::uint32_t>(i % 10, i));
+		auto msg = handler::decode_message(rb);
+		if(i < 10) {
+			REQUIRE(std::get<std::string>(msg) == std::string("Backlog ") + std::to_string(i));
+		} else {
+			REQUIRE(std::get<std::vector<std::uint32_t>>(msg) == std::vector<std::uint32_t>((i - 10) % 10, i - 10));
+		}
+	}
+	auto capacity = rb.total_capacity();
+	for(std::uint32_t i = 0; i < 1000; ++i) {
+		handler::encode_message(rb, std::vector<std::uint32_t>(i % 10, i));
+		handler::decode_message(rb);
+	}
+	CHECK(rb.total_capacity() == capacity);
+}
+
+#ifdef STRUCTOCOL_ENABLE_ASIO_SUPPORT
+TEST_CASE("ring_buffer_dynamic_view exposes the wrapped data as two buffers", "[ring_buffer]") {
+	structocol::ring_buffer rb(8);
+	auto view = rb.dynamic_view(16);
+	auto prepared = view.prepare(6);
+	CHECK(boost::asio::buffer_size(prepared) == 6);
+	std::array<std::byte, 6> input{std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}, std::byte{5}, std::byte{6}};
+	boost::asio::buffer_copy(prepared, boost::asio::buffer(input));
+	view.commit(6);
+	CHECK(view.size() == 6);
+	view.consume(4);
+	prepared = view.prepare(5);
+	CHECK(view.capacity() == 8);
+	CHECK(prepared[0].size() == 2);
+	CHECK(prepared[1].size() == 3);
+	std::array<std::byte, 5> more{std::byte{7}, std::byte{8}, std::byte{9}, std::byte{10}, std::byte{11}};
+	boost::asio::buffer_copy(prepared, boost::asio::buffer(more));
+	view.commit(4);
+	CHECK(view.size() == 6);
+	auto data = view.data();
+	CHECK(data[0].size() == 4);
+	CHECK(data[1].size() == 2);
+	std::array<std::byte, 6> output;
+	boost::asio::buffer_copy(boost::asio::buffer(output), data);
+	CHECK(output == std::array{std::byte{5}, std::byte{6}, std::byte{7}, std::byte{8}, std::byte{9}, std::byte{10}});
+	CHECK_THROWS_AS(view.prepare(11), structocol::buffer_length_error);
+	rb.skip(6);
+	CHECK(rb.available_bytes() == 0);
+}
+
+TEST_CASE("ring_buffer keeps a prepared region in place when all readable data are consumed", "[ring_buffer]") {
+	structocol::ring_buffer rb(8);
+	rb.write(std::array{std::byte{1}, std::byte{2}, std::byte{3}});
+	auto view = rb.dynamic_view();
+	auto prepared = view.prepare(4);
+	std::array<std::byte, 4> input{std::byte{4}, std::byte{5}, std::byte{6}, std::byte{7}};
+	boost::asio::buffer_copy(prepared, boost::asio::buffer(input));
+	rb.skip(2);
+	view.consume(1);
+	CHECK(rb.available_bytes() == 0);
+	view.commit(4);
+	CHECK(rb.read<4>() == input);
+	CHECK(rb.available_bytes() == 0);
+}
+#endif
@@ -1,16 +1,28 @@
 #include <algorithm>
+#include <bitset>
 #include <catch2/catch_all.hpp>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <structocol/error_code.hpp>
 #include <structocol/exceptions.hpp>
+#include <structocol/scanning.hpp>
 #include <structocol/serialization.hpp>
 #include <structocol/vector_buffer.hpp>
+#include <system_error>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <variant>
 #include <vector>
 
 namespace {
@@ -398,6 +410,42 @@ TEST_CASE("attempting to deserialize a too large varint_t results in an exceptio
 	CHECK_THROWS_AS(structocol::deserialize<structocol::varint_t>(vb), structocol::deserialization_data_error);
 }
 
+TEST_CASE("serialization of signed_varint_t preserves value", "[serialization]") {
+	auto inval = GENERATE(as<std::ptrdiff_t>{}, 0, 1, -1, 63, -64, 64, -65, 0x7FFF'FFFF, -0x8000'0000ll,
+						  std::numeric_limits<std::ptrdiff_t>::max(), std::numeric_limits<std::ptrdiff_t>::min());
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, structocol::signed_varint_t{inval});
+	auto outval = structocol::deserialize<structocol::signed_varint_t>(vb);
+	REQUIRE(inval == outval);
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("signed_varint_t uses the ZigZag mapping, making small negative values short", "[serialization]") {
+	auto check_encoding = [](std::ptrdiff_t val, std::size_t zigzag) {
+		structocol::vector_buffer signed_vb;
+		structocol::vector_buffer unsigned_vb;
+		structocol::serialize(signed_vb, structocol::signed_varint_t{val});
+		structocol::serialize(unsigned_vb, structocol::varint_t{zigzag});
+		CHECK(signed_vb.raw_vector() == unsigned_vb.raw_vector());
+	};
+	check_encoding(0, 0);
+	check_encoding(-1, 1);
+	check_encoding(1, 2);
+	check_encoding(-2, 3);
+	check_encoding(std::numeric_limits<std::ptrdiff_t>::max(), std::numeric_limits<std::size_t>::max() - 1);
+	check_encoding(std::numeric_limits<std::ptrdiff_t>::min(), std::numeric_limits<std::size_t>::max());
+	CHECK(structocol::serialized_size(structocol::signed_varint_t{-64}) == 1);
+	CHECK(structocol::serialized_size(structocol::signed_varint_t{64}) == 2);
+
+	std::vector<structocol::signed_varint_t> deltas{-3, 5, -120, 8000, 0};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, deltas);
+	CHECK(vb.available_bytes() == 1 + 1 + 1 + 2 + 2 + 1);
+	auto res = structocol::deserialize<std::vector<structocol::signed_varint_t>>(vb);
+	CHECK(std::equal(res.begin(), res.end(), deltas.begin(), deltas.end(),
+					 [](auto a, auto b) { return std::ptrdiff_t{a} == std::ptrdiff_t{b}; }));
+}
+
 namespace {
 enum class test_enum { a, b, c, d };
 } // namespace
@@ -471,6 +519,69 @@ TEMPLATE_TEST_CASE("serialization and deserialization of variants preserves valu
 	CHECK(outval == inval);
 }
 
+TEST_CASE("std::bitset is serialized with the lowest indices first, each byte beginning with its MSB",
+		  "[serialization]") {
+	std::bitset<12> bits;
+	bits.set(0).set(9).set(11);
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, bits);
+	REQUIRE(vb.available_bytes() == 2);
+	CHECK(std::to_integer<std::uint8_t>(vb.available_data()[0]) == 0x80);
+	CHECK(std::to_integer<std::uint8_t>(vb.available_data()[1]) == 0x50);
+
+	std::bitset<4096> large;
+	for(std::size_t i = 0; i < large.size(); i += 3 + i % 7) {
+		large.set(i);
+	}
+	structocol::serialize(vb, large);
+	CHECK(structocol::deserialize<std::bitset<12>>(vb) == bits);
+	CHECK(structocol::deserialize<std::bitset<4096>>(vb) == large);
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("std::vector<bool> is bit-packed like std::bitset", "[serialization]") {
+	std::vector<bool> flags{true, false, false, false, false, false, false, false, false, true, false, true};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, flags);
+	REQUIRE(vb.available_bytes() == 3);
+	CHECK(std::to_integer<std::uint8_t>(vb.available_data()[0]) == 12);
+	CHECK(std::to_integer<std::uint8_t>(vb.available_data()[1]) == 0x80);
+	CHECK(std::to_integer<std::uint8_t>(vb.available_data()[2]) == 0x50);
+	CHECK(structocol::deserialize<std::vector<bool>>(vb) == flags);
+}
+
+TEST_CASE("serialization and deserialization of std::vector<bool> preserves value", "[serialization]") {
+	auto count = GENERATE(as<std::size_t>{}, 0, 1, 7, 8, 9, 63, 64, 65, 8191, 8192, 8193, 100000);
+	std::vector<bool> inval(count);
+	for(std::size_t i = 0; i < count; ++i) {
+		inval[i] = (i * 7 + i / 5) % 3 == 0;
+	}
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, inval);
+	structocol::serialize(vb, inval);
+	structocol::serialize(vb, std::uint8_t{42});
+	CHECK(structocol::deserialize<std::vector<bool>>(vb) == inval);
+	std::vector<bool> reused(10, true);
+	structocol::deserialize_into(vb, reused);
+	CHECK(reused == inval);
+	CHECK(structocol::deserialize<std::uint8_t>(vb) == 42);
+
+	structocol::serialize(vb, inval);
+	structocol::serialize(vb, inval);
+	structocol::skip<std::vector<bool>>(vb);
+	structocol::validate<std::vector<bool>>(vb);
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("deserializing a truncated std::vector<bool> reports insufficient data", "[serialization]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, structocol::varint_t{100});
+	structocol::serialize(vb, std::array<std::uint8_t, 12>{});
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<std::vector<bool>>(vb, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+}
+
 TEST_CASE("correctly serialized magic_numbers have the expected length and pass the deserialization check",
 		  "[serialization]") {
 	SECTION("for a char sequence") {
@@ -525,3 +636,1024 @@ TEST_CASE("attempting to deserialize a magic_number from invalid data throws the
 		CHECK_THROWS_AS(structocol::deserialize<magic_number_type>(vb), structocol::deserialization_data_error);
 	}
 }
+
+namespace {
+template <typename T>
+std::vector<T> init_bulk_sequence(std::size_t count) {
+	std::vector<T> seq(count);
+	if constexpr(std::is_floating_point_v<T>) {
+		std::generate(seq.begin(), seq.end(), [v = T(-1000.5)]() mutable { return v += T(1.25); });
+	} else {
+		std::generate(seq.begin(), seq.end(), [v = std::uint64_t{0x0123456789ABCDEFu}]() mutable {
+			v = v * 6364136223846793005u + 1442695040888963407u;
+			return static_cast<T>(v >> 17);
+		});
+	}
+	return seq;
+}
+} // namespace
+
+namespace {
+// Only provides the compile-time-sized buffer interface, to test the fallback paths for buffers without span-based
+// read_into() / write().
+class fixed_size_ops_buffer {
+	structocol::vector_buffer<> vb_;
+
+public:
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		return vb_.read<bytes>();
+	}
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		vb_.write(data);
+	}
+	const std::vector<std::byte>& raw_vector() const noexcept {
+		return vb_.raw_vector();
+	}
+	std::size_t available_bytes() const noexcept {
+		return vb_.available_bytes();
+	}
+};
+static_assert(!structocol::has_span_write_member_v<fixed_size_ops_buffer>);
+static_assert(!structocol::has_read_into_member_v<fixed_size_ops_buffer>);
+static_assert(structocol::has_span_write_member_v<structocol::vector_buffer<>>);
+static_assert(structocol::has_read_into_member_v<structocol::vector_buffer<>>);
+} // namespace
+
+TEMPLATE_PRODUCT_TEST_CASE("bulk serialization of contiguous containers produces the same bytes as element-wise "
+						   "serialization",
+						   "[serialization]", std::pair,
+						   ((structocol::vector_buffer<>, std::uint8_t), (structocol::vector_buffer<>, std::int8_t),
+							(structocol::vector_buffer<>, char), (structocol::vector_buffer<>, std::uint16_t),
+							(structocol::vector_buffer<>, std::int16_t), (structocol::vector_buffer<>, std::uint32_t),
+							(structocol::vector_buffer<>, std::int32_t), (structocol::vector_buffer<>, std::uint64_t),
+							(structocol::vector_buffer<>, std::int64_t), (structocol::vector_buffer<>, float),
+							(structocol::vector_buffer<>, double), (fixed_size_ops_buffer, std::uint8_t),
+							(fixed_size_ops_buffer, std::int8_t), (fixed_size_ops_buffer, char),
+							(fixed_size_ops_buffer, std::uint16_t), (fixed_size_ops_buffer, std::int16_t),
+							(fixed_size_ops_buffer, std::uint32_t), (fixed_size_ops_buffer, std::int32_t),
+							(fixed_size_ops_buffer, std::uint64_t), (fixed_size_ops_buffer, std::int64_t),
+							(fixed_size_ops_buffer, float), (fixed_size_ops_buffer, double))) {
+	using buffer_type = typename TestType::first_type;
+	using value_type = typename TestType::second_type;
+	// Sizes chosen to hit full blocks and every power-of-two remainder part.
+	auto count = GENERATE(as<std::size_t>{}, 0, 1, 3, 127, 128, 129, 1023, 1024, 4097, 100000);
+	auto seq = init_bulk_sequence<value_type>(count);
+	std::list<value_type> reference(seq.begin(), seq.end());
+	buffer_type buffer;
+	structocol::vector_buffer vb_ref;
+	structocol::serialize(buffer, seq);
+	structocol::serialize(vb_ref, reference);
+	REQUIRE(buffer.raw_vector() == vb_ref.raw_vector());
+	auto outval = structocol::deserialize<std::vector<value_type>>(buffer);
+	CHECK(buffer.available_bytes() == 0);
+	CHECK(outval == seq);
+}
+
+TEST_CASE("serialization and deserialization of large strings and byte blobs preserves value", "[serialization]") {
+	structocol::vector_buffer vb;
+	SECTION("std::string") {
+		std::string inval(0x10000, ' ');
+		std::generate(inval.begin(), inval.end(), [c = 0]() mutable { return char('a' + (c++ % 26)); });
+		structocol::serialize(vb, inval);
+		REQUIRE(vb.available_bytes() == inval.size() + 3);
+		auto outval = structocol::deserialize<std::string>(vb);
+		CHECK(outval == inval);
+	}
+	SECTION("std::vector<std::byte>") {
+		std::vector<std::byte> inval(100000);
+		std::generate(inval.begin(), inval.end(), [b = 0u]() mutable { return std::byte(b++ * 13); });
+		structocol::serialize(vb, inval);
+		REQUIRE(vb.available_bytes() == inval.size() + 3);
+		auto outval = structocol::deserialize<std::vector<std::byte>>(vb);
+		CHECK(outval == inval);
+	}
+}
+
+TEST_CASE("bulk serialization of arrays of arithmetic types preserves value", "[serialization]") {
+	SECTION("std::array<std::uint8_t, 4096>") {
+		std::array<std::uint8_t, 4096> inval;
+		std::generate(inval.begin(), inval.end(), [v = std::uint8_t{0}]() mutable { return v += 7; });
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, inval);
+		REQUIRE(vb.available_bytes() == 4096);
+		auto outval = structocol::deserialize<std::array<std::uint8_t, 4096>>(vb);
+		CHECK(outval == inval);
+	}
+	SECTION("std::array<std::uint32_t, 300>") {
+		std::array<std::uint32_t, 300> inval;
+		std::generate(inval.begin(), inval.end(), [v = std::uint32_t{0xA0B0C0D0u}]() mutable { return v += 0x01020304u; });
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, inval);
+		REQUIRE(vb.available_bytes() == 300 * 4);
+		CHECK(vb.raw_vector()[0] == std::byte{0xA1});
+		CHECK(vb.raw_vector()[3] == std::byte{0xD4});
+		auto outval = structocol::deserialize<std::array<std::uint32_t, 300>>(vb);
+		CHECK(outval == inval);
+	}
+	SECTION("std::array<double, 17>") {
+		std::array<double, 17> inval;
+		std::generate(inval.begin(), inval.end(), [v = 0.5]() mutable { return v *= -3.0; });
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, inval);
+		REQUIRE(vb.available_bytes() == 17 * 8);
+		auto outval = structocol::deserialize<std::array<double, 17>>(vb);
+		CHECK(outval == inval);
+	}
+}
+
+TEST_CASE("bulk deserialization of a truncated container throws the expected exception", "[serialization]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, init_bulk_sequence<std::uint32_t>(2000));
+	structocol::vector_buffer truncated;
+	for(std::size_t i = 0; i < 5000; ++i) {
+		truncated.write(std::array{vb.read<1>().front()});
+	}
+	CHECK_THROWS_AS(structocol::deserialize<std::vector<std::uint32_t>>(truncated), structocol::buffer_length_error);
+}
+
+namespace {
+struct try_test_msg {
+	std::string name;
+	std::vector<std::uint32_t> values;
+	std::map<std::string, std::optional<std::int16_t>> attributes;
+	std::variant<std::monostate, test_a, std::string> payload;
+	structocol::format_version_magic_number_t version;
+};
+} // namespace
+
+TEST_CASE("try_deserialize reports insufficient data via error code for every truncation", "[serialization]") {
+	try_test_msg msg{"test", {1, 2, 3, 0xFFFFFFFF}, {{"a", 5}, {"b", std::nullopt}}, init_aggregate<test_a>(), {}};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, msg);
+	auto data = vb.available_data();
+	for(std::size_t len = 0; len < data.size(); ++len) {
+		structocol::vector_buffer truncated;
+		truncated.write(data.first(len));
+		std::error_code ec;
+		std::optional<try_test_msg> res;
+		REQUIRE_NOTHROW(res = structocol::try_deserialize<try_test_msg>(truncated, ec));
+		CHECK(!res.has_value());
+		CHECK(ec == structocol::errc::insufficient_data);
+	}
+	std::error_code ec = structocol::errc::invalid_data;
+	auto res = structocol::try_deserialize<try_test_msg>(vb, ec);
+	CHECK(!ec);
+	REQUIRE(res.has_value());
+	CHECK(res->name == msg.name);
+	CHECK(res->values == msg.values);
+	CHECK(res->attributes == msg.attributes);
+	CHECK(std::get<test_a>(res->payload) == init_aggregate<test_a>());
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("try_deserialize reports invalid data via error code", "[serialization]") {
+	std::error_code ec;
+	SECTION("too large varint_t") {
+		structocol::vector_buffer vb;
+		for(std::size_t i = 0; i < sizeof(std::size_t) * 2; ++i) {
+			vb.write(std::array{std::byte(0xFFu)});
+		}
+		vb.write(std::array{std::byte(0x7Fu)});
+		CHECK(!structocol::try_deserialize<structocol::varint_t>(vb, ec).has_value());
+	}
+	SECTION("wrong magic number") {
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, std::uint32_t{0x12345678});
+		CHECK(!structocol::try_deserialize<structocol::format_version_magic_number_t>(vb, ec).has_value());
+	}
+	SECTION("invalid variant index") {
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, std::uint8_t{3});
+		CHECK(!structocol::try_deserialize<std::variant<std::monostate, test_a, std::string>>(vb, ec).has_value());
+		structocol::serialize(vb, std::uint8_t{3});
+		CHECK_THROWS_AS((structocol::deserialize<std::variant<std::monostate, test_a, std::string>>(vb)),
+						structocol::deserialization_data_error);
+	}
+	CHECK(ec == structocol::errc::invalid_data);
+	CHECK(ec.category() == structocol::error_category());
+	CHECK(!ec.message().empty());
+}
+
+TEST_CASE("try_deserialize stops early on a bogus container length", "[serialization]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, structocol::varint_t{std::size_t{1} << 40});
+	structocol::serialize(vb, std::string("abc"));
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<std::vector<std::string>>(vb, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+	vb.clear();
+	structocol::serialize(vb, structocol::varint_t{std::size_t{1} << 40});
+	CHECK(!structocol::try_deserialize<std::vector<std::uint16_t>>(vb, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+}
+
+namespace {
+struct reuse_test_msg {
+	std::string name;
+	std::vector<std::uint32_t> values;
+	std::vector<std::string> tags;
+	std::map<std::string, std::vector<std::int16_t>> series;
+	std::optional<std::string> comment;
+	std::variant<std::monostate, test_a, std::string> payload;
+	std::tuple<std::string, std::pair<std::string, std::uint8_t>> extra;
+	std::array<std::string, 2> labels;
+	std::vector<bool> flags;
+};
+bool operator==(const reuse_test_msg& a, const reuse_test_msg& b) {
+	return std::tie(a.name, a.values, a.tags, a.series, a.comment, a.payload, a.extra, a.labels, a.flags) ==
+		   std::tie(b.name, b.values, b.tags, b.series, b.comment, b.payload, b.extra, b.labels, b.flags);
+}
+reuse_test_msg make_reuse_test_msg(std::size_t variation) {
+	auto str = [variation](const char* s) { return std::string(s) + std::string(20 + variation, 'x'); };
+	return reuse_test_msg{str("name"),
+						  init_bulk_sequence<std::uint32_t>(100 + variation),
+						  {str("a"), str("b"), str("c")},
+						  {{"k1", {1, 2, 3}}, {"k2", std::vector<std::int16_t>(10, std::int16_t(variation))}},
+						  str("comment"),
+						  str("payload"),
+						  {str("t"), {str("p"), std::uint8_t(variation)}},
+						  {str("l1"), str("l2")},
+						  {true, false, variation % 2 == 0}};
+}
+} // namespace
+
+TEST_CASE("deserialize_into preserves value and reuses the existing storage of the target", "[serialization]") {
+	reuse_test_msg target;
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, make_reuse_test_msg(10));
+	structocol::deserialize_into(vb, target);
+	REQUIRE(target == make_reuse_test_msg(10));
+
+	const auto* name_data = target.name.data();
+	const auto* values_data = target.values.data();
+	const auto* tag_data = target.tags[1].data();
+	const auto* series_node = &*target.series.begin();
+	const auto* series_data = target.series.begin()->second.data();
+	const auto* comment_data = target.comment->data();
+	const auto* payload_data = std::get<std::string>(target.payload).data();
+	const auto* extra_data = std::get<1>(target.extra).first.data();
+	const auto* label_data = target.labels[0].data();
+	for(std::size_t variation = 10; variation > 0; --variation) {
+		structocol::serialize(vb, make_reuse_test_msg(variation));
+		structocol::deserialize_into(vb, target);
+		REQUIRE(target == make_reuse_test_msg(variation));
+		CHECK(target.name.data() == name_data);
+		CHECK(target.values.data() == values_data);
+		CHECK(target.tags[1].data() == tag_data);
+		CHECK(&*target.series.begin() == series_node);
+		CHECK(target.series.begin()->second.data() == series_data);
+		CHECK(target.comment->data() == comment_data);
+		CHECK(std::get<std::string>(target.payload).data() == payload_data);
+		CHECK(std::get<1>(target.extra).first.data() == extra_data);
+		CHECK(target.labels[0].data() == label_data);
+	}
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("deserialize_into handles changing element counts and alternatives", "[serialization]") {
+	structocol::vector_buffer vb;
+	std::vector<std::string> vec{"a", "b", "c"};
+	std::map<std::string, std::uint8_t> map{{"x", 1}, {"y", 2}};
+	std::variant<std::monostate, test_a, std::string> var = std::string("abc");
+	std::optional<std::string> opt;
+	structocol::serialize(vb, std::vector<std::string>{"d"});
+	structocol::serialize(vb, std::map<std::string, std::uint8_t>{{"a", 3}, {"b", 4}, {"c", 5}});
+	structocol::serialize(vb, std::variant<std::monostate, test_a, std::string>(init_aggregate<test_a>()));
+	structocol::serialize(vb, std::optional<std::string>("value"));
+	structocol::deserialize_into(vb, vec);
+	structocol::deserialize_into(vb, map);
+	structocol::deserialize_into(vb, var);
+	structocol::deserialize_into(vb, opt);
+	CHECK(vec == std::vector<std::string>{"d"});
+	CHECK(map == std::map<std::string, std::uint8_t>{{"a", 3}, {"b", 4}, {"c", 5}});
+	CHECK(std::get<test_a>(var) == init_aggregate<test_a>());
+	CHECK(opt == "value");
+	structocol::serialize(vb, std::map<std::string, std::uint8_t>{});
+	structocol::serialize(vb, std::optional<std::string>());
+	structocol::deserialize_into(vb, map);
+	structocol::deserialize_into(vb, opt);
+	CHECK(map.empty());
+	CHECK(!opt.has_value());
+}
+
+TEST_CASE("try_deserialize_into reports errors via error code", "[serialization]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, make_reuse_test_msg(3));
+	structocol::vector_buffer truncated;
+	truncated.write(vb.available_data().first(vb.available_bytes() / 2));
+	reuse_test_msg target = make_reuse_test_msg(5);
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize_into(truncated, target, ec));
+	CHECK(ec == structocol::errc::insufficient_data);
+	CHECK(structocol::try_deserialize_into(vb, target, ec));
+	CHECK(!ec);
+	CHECK(target == make_reuse_test_msg(3));
+}
+
+namespace {
+struct borrowing_msg {
+	std::uint32_t id;
+	std::string_view name;
+	std::span<const std::byte> blob;
+	std::vector<std::string_view> tags;
+	std::optional<std::span<const std::uint8_t>> extra;
+};
+struct owning_msg {
+	std::uint32_t id;
+	std::string name;
+	std::vector<std::byte> blob;
+	std::vector<std::string> tags;
+	std::optional<std::vector<std::uint8_t>> extra;
+};
+} // namespace
+
+TEST_CASE("borrowed views are serialized like the owning containers and borrow from the buffer on deserialization",
+		  "[serialization]") {
+	owning_msg in{42, "some name", {std::byte{1}, std::byte{2}, std::byte{3}}, {"a", "bc", ""}, {{4, 5, 6, 7}}};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, in);
+	auto storage = vb.available_data();
+	auto out = structocol::deserialize<borrowing_msg>(vb);
+	CHECK(vb.available_bytes() == 0);
+	CHECK(out.id == in.id);
+	CHECK(out.name == in.name);
+	CHECK(std::equal(out.blob.begin(), out.blob.end(), in.blob.begin(), in.blob.end()));
+	CHECK(std::equal(out.tags.begin(), out.tags.end(), in.tags.begin(), in.tags.end()));
+	REQUIRE(out.extra.has_value());
+	CHECK(std::equal(out.extra->begin(), out.extra->end(), in.extra->begin(), in.extra->end()));
+	auto points_into_storage = [&storage](const void* p) {
+		auto b = static_cast<const std::byte*>(p);
+		return b >= storage.data() && b < storage.data() + storage.size();
+	};
+	CHECK(points_into_storage(out.name.data()));
+	CHECK(points_into_storage(out.blob.data()));
+	CHECK(points_into_storage(out.tags[1].data()));
+	CHECK(points_into_storage(out.extra->data()));
+
+	structocol::serialize(vb, out);
+	CHECK(structocol::serialized_size(out) == structocol::serialized_size(in));
+	auto in2 = structocol::deserialize<owning_msg>(vb);
+	CHECK(in2.name == in.name);
+	CHECK(in2.blob == in.blob);
+	CHECK(in2.tags == in.tags);
+	CHECK(in2.extra == in.extra);
+}
+
+TEST_CASE("deserializing a truncated borrowed view reports the expected error", "[serialization]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, std::string("0123456789"));
+	structocol::vector_buffer truncated;
+	truncated.write(vb.available_data().first(8));
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<std::string_view>(truncated, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+	truncated.clear();
+	truncated.write(vb.available_data().first(8));
+	CHECK_THROWS_AS(structocol::deserialize<std::string_view>(truncated), structocol::buffer_length_error);
+}
+
+namespace {
+struct checked_elem {
+	std::uint16_t value;
+	structocol::magic_number<'O', 'K'> check;
+};
+struct skip_test_msg {
+	test_b fixed;
+	std::string name;
+	std::vector<std::uint64_t> numbers;
+	std::vector<checked_elem> checked;
+	std::map<std::string, std::optional<std::vector<std::int16_t>>> series;
+	std::variant<std::monostate, test_a, std::vector<std::string>> payload;
+	std::tuple<std::uint32_t, std::pair<std::string, std::array<std::string, 2>>> extra;
+	std::string_view note;
+	std::bitset<12> bits;
+};
+skip_test_msg make_skip_test_msg() {
+	return skip_test_msg{init_aggregate<test_b>(),
+						 "name",
+						 init_bulk_sequence<std::uint64_t>(5000),
+						 {{1, {}}, {2, {}}},
+						 {{"a", std::nullopt}, {"b", std::vector<std::int16_t>{1, 2, 3}}},
+						 std::vector<std::string>{"x", "yz"},
+						 {300, {"p", {"q", "r"}}},
+						 "note",
+						 0xABC};
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("skip and validate advance the buffer past the serialized value", "[serialization]",
+				   structocol::vector_buffer<>, fixed_size_ops_buffer) {
+	TestType buffer;
+	auto msg = make_skip_test_msg();
+	for(int i = 0; i < 3; ++i) {
+		structocol::serialize(buffer, msg);
+		structocol::serialize(buffer, std::uint32_t{0xC0FFEEu});
+	}
+	structocol::skip<skip_test_msg>(buffer);
+	CHECK(structocol::deserialize<std::uint32_t>(buffer) == 0xC0FFEEu);
+	structocol::validate<skip_test_msg>(buffer);
+	CHECK(structocol::deserialize<std::uint32_t>(buffer) == 0xC0FFEEu);
+	structocol::skip<test_b>(buffer);
+	structocol::skip<std::string>(buffer);
+	structocol::skip<std::vector<std::uint64_t>>(buffer);
+	structocol::skip<std::vector<checked_elem>>(buffer);
+	structocol::validate<std::map<std::string, std::optional<std::vector<std::int16_t>>>>(buffer);
+	structocol::skip<std::variant<std::monostate, test_a, std::vector<std::string>>>(buffer);
+	structocol::validate<std::tuple<std::uint32_t, std::pair<std::string, std::array<std::string, 2>>>>(
+			buffer);
+	structocol::skip<std::string_view>(buffer);
+	structocol::validate<std::bitset<12>>(buffer);
+	CHECK(structocol::deserialize<std::uint32_t>(buffer) == 0xC0FFEEu);
+	CHECK(buffer.available_bytes() == 0);
+}
+
+TEST_CASE("validate detects invalid data that skip passes over", "[serialization]") {
+	structocol::vector_buffer vb;
+	auto msg = make_skip_test_msg();
+	structocol::serialize(vb, msg);
+	auto data = vb.available_data();
+	std::vector<std::byte> corrupted(data.begin(), data.end());
+	// Corrupt the magic number of the second checked element.
+	auto checked_offset = structocol::serialized_size(msg.fixed) + structocol::serialized_size(msg.name) +
+						  structocol::serialized_size(msg.numbers) + 1;
+	corrupted[checked_offset + 4 + 2] = std::byte{'X'};
+	structocol::vector_buffer cb;
+	cb.write(corrupted);
+	structocol::skip<skip_test_msg>(cb);
+	CHECK(cb.available_bytes() == 0);
+	cb.write(corrupted);
+	CHECK_THROWS_AS(structocol::validate<skip_test_msg>(cb), structocol::deserialization_data_error);
+	cb.clear();
+	cb.write(corrupted);
+	std::error_code ec;
+	CHECK(!structocol::try_validate<skip_test_msg>(cb, ec));
+	CHECK(ec == structocol::errc::invalid_data);
+	cb.clear();
+	cb.write(data.first(data.size() - 1));
+	CHECK(!structocol::try_validate<skip_test_msg>(cb, ec));
+	CHECK(ec == structocol::errc::insufficient_data);
+	cb.clear();
+	cb.write(data.first(data.size() - 1));
+	CHECK_THROWS_AS(structocol::skip<skip_test_msg>(cb), structocol::buffer_length_error);
+	cb.clear();
+	structocol::serialize(cb, std::uint8_t{3});
+	CHECK_THROWS_AS((structocol::skip<std::variant<std::monostate, test_a, std::vector<std::string>>>(cb)),
+					structocol::deserialization_data_error);
+}
+
+namespace {
+enum class side : std::uint8_t { bid, ask };
+struct flat_update {
+	std::uint64_t instrument;
+	side s;
+	double price;
+	float qty;
+	std::array<std::int16_t, 3> levels;
+	test_a nested;
+	bool last;
+	structocol::magic_number<'E', 'N', 'D'> end;
+};
+static_assert(structocol::has_fixed_serialized_size_v<flat_update>);
+
+// Counts the buffer operations, to check that fixed-size aggregates are transferred as one block.
+class op_counting_buffer {
+	structocol::vector_buffer<> vb_;
+
+public:
+	std::size_t reads = 0;
+	std::size_t writes = 0;
+
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		++reads;
+		return vb_.read<bytes>();
+	}
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		++writes;
+		vb_.write(data);
+	}
+	const std::vector<std::byte>& raw_vector() const noexcept {
+		return vb_.raw_vector();
+	}
+};
+} // namespace
+
+TEST_CASE("fixed-size aggregates are transferred as one block with the field-wise encoding", "[serialization]") {
+	flat_update in{0x0102030405060708, side::ask, 123.25, 4.5f, {-1, 2, -3}, init_aggregate<test_a>(), true, {}};
+	op_counting_buffer buffer;
+	structocol::serialize(buffer, in);
+	CHECK(buffer.writes == 1);
+	CHECK(buffer.raw_vector().size() == structocol::serialized_size<flat_update>());
+
+	structocol::vector_buffer fieldwise;
+	boost::pfr::for_each_field(in, [&fieldwise](const auto& field) { structocol::serialize(fieldwise, field); });
+	CHECK(buffer.raw_vector() == fieldwise.raw_vector());
+
+	auto out = structocol::deserialize<flat_update>(buffer);
+	CHECK(buffer.reads == 1);
+	CHECK(out.instrument == in.instrument);
+	CHECK(out.s == in.s);
+	CHECK(out.price == in.price);
+	CHECK(out.qty == in.qty);
+	CHECK(out.levels == in.levels);
+	CHECK(out.nested == in.nested);
+	CHECK(out.last == in.last);
+
+	flat_update target{};
+	structocol::deserialize_into(fieldwise, target);
+	CHECK(target.nested == in.nested);
+	CHECK(target.levels == in.levels);
+}
+
+TEST_CASE("errors in fixed-size aggregates are reported through the original buffer", "[serialization]") {
+	flat_update in{1, side::bid, 1.0, 2.0f, {}, {}, false, {}};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, in);
+	auto corrupted = vb.raw_vector();
+	corrupted.back() = std::byte{'X'};
+	structocol::vector_buffer cb;
+	cb.write(corrupted);
+	CHECK_THROWS_AS(structocol::deserialize<flat_update>(cb), structocol::deserialization_data_error);
+	cb.clear();
+	cb.write(corrupted);
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<flat_update>(cb, ec).has_value());
+	CHECK(ec == structocol::errc::invalid_data);
+	cb.clear();
+	cb.write(corrupted);
+	CHECK(!structocol::try_validate<flat_update>(cb, ec));
+	CHECK(ec == structocol::errc::invalid_data);
+	cb.clear();
+	cb.write(std::span(corrupted).first(corrupted.size() - 1));
+	CHECK(!structocol::try_deserialize<flat_update>(cb, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+}
+
+namespace {
+// Counts how often values are moved or copied, to check that deserialization constructs them in place.
+class relocation_counted {
+	std::uint32_t value_ = 0;
+
+public:
+	static inline std::size_t relocations = 0;
+
+	explicit relocation_counted(std::uint32_t value) noexcept : value_{value} {}
+	relocation_counted(const relocation_counted& other) noexcept : value_{other.value_} {
+		++relocations;
+	}
+	relocation_counted(relocation_counted&& other) noexcept : value_{other.value_} {
+		++relocations;
+	}
+	relocation_counted& operator=(const relocation_counted&) = default;
+	relocation_counted& operator=(relocation_counted&&) = default;
+	~relocation_counted() = default;
+
+	std::uint32_t value() const noexcept {
+		return value_;
+	}
+};
+} // namespace
+
+template <>
+struct structocol::serializer<relocation_counted> {
+	template <typename Buff>
+	static void serialize(Buff& buffer, const relocation_counted& val) {
+		structocol::serialize(buffer, val.value());
+	}
+	template <typename Buff>
+	static relocation_counted deserialize(Buff& buffer) {
+		return relocation_counted(structocol::deserialize<std::uint32_t>(buffer));
+	}
+	static std::size_t size(const relocation_counted&) {
+		return sizeof(std::uint32_t);
+	}
+};
+
+namespace {
+struct relocation_inner {
+	relocation_counted a;
+	std::string name;
+	relocation_counted b;
+};
+struct relocation_outer {
+	relocation_inner inner;
+	std::array<relocation_counted, 3> elements;
+	relocation_counted last;
+};
+} // namespace
+
+TEST_CASE("aggregates and arrays are deserialized in place in wire order", "[serialization]") {
+	structocol::vector_buffer vb;
+	for(std::uint32_t i = 1; i <= 6; ++i) {
+		if(i == 2) structocol::serialize(vb, std::string("name"));
+		structocol::serialize(vb, i);
+	}
+	relocation_counted::relocations = 0;
+	auto res = structocol::deserialize<relocation_outer>(vb);
+	CHECK(relocation_counted::relocations == 0);
+	CHECK(res.inner.a.value() == 1);
+	CHECK(res.inner.name == "name");
+	CHECK(res.inner.b.value() == 2);
+	CHECK(res.elements[0].value() == 3);
+	CHECK(res.elements[1].value() == 4);
+	CHECK(res.elements[2].value() == 5);
+	CHECK(res.last.value() == 6);
+
+	structocol::serialize(vb, std::uint32_t{7});
+	structocol::serialize(vb, std::uint32_t{8});
+	relocation_counted::relocations = 0;
+	auto tup = structocol::deserialize<std::tuple<relocation_counted, relocation_counted>>(vb);
+	// std::tuple can't be aggregate-initialized, each element is moved once.
+	CHECK(relocation_counted::relocations == 2);
+	CHECK(std::get<0>(tup).value() == 7);
+	CHECK(std::get<1>(tup).value() == 8);
+}
+
+TEST_CASE("decode limits bound container lengths, total size and nesting depth", "[serialization]") {
+	structocol::vector_buffer vb;
+	std::vector<std::vector<std::uint32_t>> nested{{1, 2, 3}, {4, 5}, {}};
+	std::error_code ec;
+
+	SECTION("data within the limits are decoded normally") {
+		structocol::serialize(vb, nested);
+		structocol::decode_limits limits{3, 5 * sizeof(std::uint32_t) + 3 * sizeof(std::vector<std::uint32_t>), 2};
+		CHECK(structocol::deserialize<decltype(nested)>(vb, limits) == nested);
+		structocol::serialize(vb, nested);
+		auto res = structocol::try_deserialize<decltype(nested)>(vb, ec, limits);
+		REQUIRE(res.has_value());
+		CHECK(*res == nested);
+		structocol::serialize(vb, nested);
+		decltype(nested) target;
+		structocol::deserialize_into(vb, target, limits);
+		CHECK(target == nested);
+	}
+	SECTION("container length") {
+		structocol::serialize(vb, nested);
+		structocol::decode_limits limits;
+		limits.max_elements = 2;
+		CHECK_THROWS_AS(structocol::deserialize<decltype(nested)>(vb, limits), structocol::decode_limit_error);
+		vb.clear();
+		structocol::serialize(vb, nested);
+		CHECK(!structocol::try_deserialize<decltype(nested)>(vb, ec, limits).has_value());
+		CHECK(ec == structocol::errc::limit_exceeded);
+	}
+	SECTION("total size") {
+		structocol::serialize(vb, nested);
+		structocol::decode_limits limits;
+		limits.max_total_bytes = 3 * sizeof(std::vector<std::uint32_t>) + 4 * sizeof(std::uint32_t);
+		CHECK_THROWS_AS(structocol::deserialize<decltype(nested)>(vb, limits), structocol::decode_limit_error);
+		vb.clear();
+		structocol::serialize(vb, nested);
+		decltype(nested) target;
+		CHECK(!structocol::try_deserialize_into(vb, target, ec, limits));
+		CHECK(ec == structocol::errc::limit_exceeded);
+	}
+	SECTION("nesting depth") {
+		structocol::serialize(vb, nested);
+		structocol::decode_limits limits;
+		limits.max_depth = 1;
+		CHECK_THROWS_AS(structocol::deserialize<decltype(nested)>(vb, limits), structocol::decode_limit_error);
+	}
+	SECTION("limits apply to containers inside of other types") {
+		structocol::serialize(vb, std::tuple<std::optional<std::string>, std::uint8_t>{std::string(100, 'x'), 1});
+		structocol::decode_limits limits;
+		limits.max_elements = 99;
+		CHECK_THROWS_AS((structocol::deserialize<std::tuple<std::optional<std::string>, std::uint8_t>>(vb, limits)),
+						structocol::decode_limit_error);
+	}
+}
+
+TEST_CASE("containers are reserved for their length, capped by the remaining data", "[serialization]") {
+	structocol::vector_buffer vb;
+	std::vector<std::string> strings(1000, "s");
+	structocol::serialize(vb, strings);
+	auto res = structocol::deserialize<std::vector<std::string>>(vb);
+	CHECK(res == strings);
+	CHECK(res.capacity() == strings.size());
+
+	// A bogus length doesn't cause a huge reservation when only little data follow.
+	structocol::serialize(vb, structocol::varint_t{std::size_t{1} << 40});
+	structocol::serialize(vb, std::string("a"));
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<std::vector<std::string>>(vb, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+}
+
+namespace {
+struct pmr_test_msg {
+	std::pmr::string name;
+	std::pmr::vector<std::pmr::string> tags;
+	std::pmr::map<std::pmr::string, std::pmr::vector<std::int32_t>> series;
+	std::optional<std::pmr::string> comment;
+	std::vector<std::uint8_t> plain;
+};
+
+// Counts the allocations made through it, to check that containers allocate from the given resource.
+class counting_resource : public std::pmr::memory_resource {
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+
+public:
+	std::size_t allocations = 0;
+};
+} // namespace
+
+TEST_CASE("pmr containers are allocated from the memory resource passed to deserialize", "[serialization]") {
+	pmr_test_msg msg{"a name that is too long for the small string optimization",
+					 {"first tag that is long enough to allocate", "second tag that is long enough to allocate"},
+					 {{"key that is long enough to allocate on the heap", {1, 2, 3}}},
+					 "a comment that is long enough to allocate on the heap",
+					 {1, 2, 3}};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, msg);
+	structocol::serialize(vb, msg);
+
+	counting_resource resource;
+	auto old_default = std::pmr::set_default_resource(std::pmr::null_memory_resource());
+	std::optional<pmr_test_msg> res;
+	std::error_code ec;
+	CHECK_NOTHROW(res = structocol::deserialize<pmr_test_msg>(vb, resource));
+	CHECK_NOTHROW(res = structocol::try_deserialize<pmr_test_msg>(vb, ec, resource));
+	std::pmr::set_default_resource(old_default);
+
+	REQUIRE(res.has_value());
+	CHECK(resource.allocations > 0);
+	CHECK(res->name == msg.name);
+	CHECK(res->tags == msg.tags);
+	CHECK(res->series == msg.series);
+	CHECK(res->comment == msg.comment);
+	CHECK(res->plain == msg.plain);
+	CHECK(res->name.get_allocator().resource() == &resource);
+	CHECK(res->tags.get_allocator().resource() == &resource);
+	CHECK(res->tags.front().get_allocator().resource() == &resource);
+	CHECK(res->series.begin()->first.get_allocator().resource() == &resource);
+	CHECK(res->series.begin()->second.get_allocator().resource() == &resource);
+	CHECK(res->comment->get_allocator().resource() == &resource);
+}
+
+TEMPLATE_TEST_CASE("varint_t decoding handles values at the end of the data and overlong encodings", "[serialization]",
+				   structocol::vector_buffer<>, fixed_size_ops_buffer) {
+	constexpr auto max_valid_bytes = (sizeof(std::size_t) * 8) / 7 + ((((sizeof(std::size_t) * 8) % 7) != 0) ? 1 : 0);
+	TestType buffer;
+	SECTION("values directly at the end of the data") {
+		for(std::size_t val : {std::size_t{0}, std::size_t{0x80}, std::numeric_limits<std::size_t>::max()}) {
+			structocol::serialize(buffer, structocol::varint_t{val});
+			CHECK(structocol::deserialize<structocol::varint_t>(buffer) == val);
+		}
+	}
+	SECTION("truncated value") {
+		buffer.write(std::array{std::byte(0x81u), std::byte(0x80u)});
+		CHECK_THROWS_AS(structocol::deserialize<structocol::varint_t>(buffer), structocol::buffer_length_error);
+	}
+	SECTION("redundant leading zero groups") {
+		for(std::size_t i = 0; i < max_valid_bytes + 2; ++i) {
+			buffer.write(std::array{std::byte(0x80u)});
+		}
+		buffer.write(std::array{std::byte(0x05u), std::byte(0x2Au)});
+		CHECK(structocol::deserialize<structocol::varint_t>(buffer) == 5);
+		CHECK(structocol::deserialize<std::uint8_t>(buffer) == 0x2A);
+	}
+	SECTION("longest encoding with excess bits") {
+		buffer.write(std::array{std::byte(0x82u)});
+		for(std::size_t i = 1; i < max_valid_bytes - 1; ++i) {
+			buffer.write(std::array{std::byte(0x80u)});
+		}
+		buffer.write(std::array{std::byte(0x00u), std::byte(0x2Au)});
+		CHECK_THROWS_AS(structocol::deserialize<structocol::varint_t>(buffer), structocol::deserialization_data_error);
+	}
+}
+
+TEST_CASE("varint_t is written with one buffer operation", "[serialization]") {
+	auto val = GENERATE(as<std::size_t>{}, 0, 0x7F, 0x80, 0xFFFF'FFFF, std::numeric_limits<std::size_t>::max());
+	op_counting_buffer buffer;
+	structocol::serialize(buffer, structocol::varint_t{val});
+	CHECK(buffer.writes == 1);
+	CHECK(buffer.raw_vector().size() == structocol::serialized_size(structocol::varint_t{val}));
+}
+
+namespace {
+struct format_test_header {
+	std::uint32_t id;
+	std::int16_t delta;
+	double price;
+};
+struct format_test_msg {
+	format_test_header header;
+	std::vector<std::uint32_t> values;
+	std::array<std::int64_t, 3> offsets;
+	std::map<std::string, std::uint16_t> counts;
+	std::optional<float> ratio;
+};
+bool operator==(const format_test_msg& a, const format_test_msg& b) {
+	return std::tie(a.header.id, a.header.delta, a.header.price, a.values, a.offsets, a.counts, a.ratio) ==
+		   std::tie(b.header.id, b.header.delta, b.header.price, b.values, b.offsets, b.counts, b.ratio);
+}
+format_test_msg make_format_test_msg() {
+	return format_test_msg{
+			{0x01020304u, -2, 1.5}, {1, 300, 70000, 0xFFFF'FFFFu}, {{-1, 0, 1ll << 40}}, {{"a", 1}, {"b", 0xFFFF}}, 0.25f};
+}
+template <typename Policy>
+std::vector<std::uint8_t> serialized_bytes(const auto& val) {
+	structocol::vector_buffer vb;
+	structocol::serialize<Policy>(vb, val);
+	std::vector<std::uint8_t> res;
+	for(auto b : vb.available_data()) {
+		res.push_back(std::to_integer<std::uint8_t>(b));
+	}
+	return res;
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("values arrive as they were sent in all wire formats", "[serialization][format_policy]",
+				   structocol::big_endian_format, structocol::little_endian_format, structocol::varint_format) {
+	auto msg = make_format_test_msg();
+	structocol::vector_buffer vb;
+	structocol::serialize<TestType>(vb, msg);
+	CHECK(vb.available_bytes() == structocol::serialized_size<TestType>(msg));
+	structocol::serialize<TestType>(vb, msg);
+	structocol::serialize<TestType>(vb, msg);
+	CHECK(structocol::deserialize<format_test_msg, TestType>(vb) == msg);
+	format_test_msg target{};
+	structocol::deserialize_into<TestType>(vb, target);
+	CHECK(target == msg);
+	std::error_code ec;
+	CHECK(structocol::try_deserialize<format_test_msg, TestType>(vb, ec) == msg);
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("little_endian_format stores integers and floating point values in little endian byte order",
+		  "[serialization][format_policy]") {
+	using bytes = std::vector<std::uint8_t>;
+	CHECK(serialized_bytes<structocol::little_endian_format>(std::uint32_t{0x01020304u}) == bytes{4, 3, 2, 1});
+	CHECK(serialized_bytes<structocol::big_endian_format>(std::uint32_t{0x01020304u}) == bytes{1, 2, 3, 4});
+	CHECK(serialized_bytes<structocol::little_endian_format>(std::int16_t{-2}) == bytes{0xFE, 0xFF});
+	CHECK(serialized_bytes<structocol::little_endian_format>(1.0f) == bytes{0x00, 0x00, 0x80, 0x3F});
+	CHECK(serialized_bytes<structocol::little_endian_format>(std::vector<std::uint16_t>{0x0102, 0x0304}) ==
+		  bytes{2, 0x02, 0x01, 0x04, 0x03});
+	CHECK(serialized_bytes<structocol::little_endian_format>(format_test_header{0x01020304u, 1, 0.0}) ==
+		  bytes{4, 3, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0});
+	STATIC_REQUIRE(structocol::serialized_size<format_test_header, structocol::little_endian_format>() == 14);
+}
+
+TEST_CASE("varint_format stores integers as varints", "[serialization][format_policy]") {
+	using bytes = std::vector<std::uint8_t>;
+	CHECK(serialized_bytes<structocol::varint_format>(std::uint64_t{5}) == bytes{5});
+	CHECK(serialized_bytes<structocol::varint_format>(std::int32_t{-1}) == bytes{1});
+	CHECK(serialized_bytes<structocol::varint_format>(std::uint16_t{300}) == bytes{0x82, 0x2C});
+	CHECK(serialized_bytes<structocol::varint_format>(std::uint8_t{200}) == bytes{200});
+	CHECK(serialized_bytes<structocol::varint_format>(std::vector<std::uint32_t>{1, 2}) == bytes{2, 1, 2});
+	CHECK(serialized_bytes<structocol::varint_format>(format_test_header{1, -1, 0.0}) ==
+		  bytes{1, 1, 0, 0, 0, 0, 0, 0, 0, 0});
+	auto msg = make_format_test_msg();
+	CHECK(structocol::serialized_size<structocol::varint_format>(msg) < structocol::serialized_size(msg));
+
+	structocol::vector_buffer vb;
+	structocol::serialize<structocol::varint_format>(vb, msg);
+	structocol::serialize<structocol::varint_format>(vb, msg);
+	structocol::serialize<structocol::varint_format>(vb, std::uint32_t{70000});
+	structocol::skip<format_test_msg, structocol::varint_format>(vb);
+	structocol::validate<format_test_msg, structocol::varint_format>(vb);
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<std::uint16_t, structocol::varint_format>(vb, ec).has_value());
+	CHECK(ec == structocol::errc::invalid_data);
+}
+
+TEST_CASE("format version headers differ between wire formats", "[serialization][format_policy]") {
+	structocol::vector_buffer vb;
+	structocol::write_format_version_header<structocol::little_endian_format>(vb);
+	structocol::write_format_version_header(vb);
+	CHECK_NOTHROW(structocol::check_format_version_header<structocol::little_endian_format>(vb));
+	CHECK_THROWS_AS(structocol::check_format_version_header<structocol::varint_format>(vb),
+					structocol::deserialization_data_error);
+}
+
+namespace {
+struct sparse_update {
+	std::uint32_t id;
+	std::optional<std::uint32_t> price;
+	std::optional<std::string> name;
+	std::optional<std::uint16_t> quantity;
+	std::string source;
+	std::optional<std::int64_t> timestamp;
+	std::optional<std::vector<std::uint16_t>> levels;
+	std::optional<std::uint8_t> flags;
+	std::optional<double> ratio;
+	std::optional<std::uint32_t> extra;
+	std::optional<bool> urgent;
+};
+bool operator==(const sparse_update& a, const sparse_update& b) {
+	return std::tie(a.id, a.price, a.name, a.quantity, a.source, a.timestamp, a.levels, a.flags, a.ratio, a.extra,
+					a.urgent) == std::tie(b.id, b.price, b.name, b.quantity, b.source, b.timestamp, b.levels, b.flags,
+										  b.ratio, b.extra, b.urgent);
+}
+// Same fields, but using the default encoding.
+struct plain_update {
+	std::uint32_t id;
+	std::optional<std::uint32_t> price;
+	std::optional<std::string> name;
+	std::optional<std::uint16_t> quantity;
+	std::string source;
+	std::optional<std::int64_t> timestamp;
+	std::optional<std::vector<std::uint16_t>> levels;
+	std::optional<std::uint8_t> flags;
+	std::optional<double> ratio;
+	std::optional<std::uint32_t> extra;
+	std::optional<bool> urgent;
+};
+} // namespace
+
+template <>
+struct structocol::serializer<sparse_update> : structocol::presence_bitmap_serializer<sparse_update> {};
+
+namespace {
+std::vector<sparse_update> make_sparse_updates() {
+	return {sparse_update{1, {}, {}, {}, "a", {}, {}, {}, {}, {}, {}},
+			sparse_update{2, 100, {}, 3, "b", {}, {}, {}, {}, 7, {}},
+			sparse_update{3, {}, "name", {}, "", -5, std::vector<std::uint16_t>{1, 2, 3}, {}, 0.5, {}, false},
+			sparse_update{4, 1, "n", 2, "src", 3, std::vector<std::uint16_t>{}, 4, 5.0, 6, true}};
+}
+} // namespace
+
+TEST_CASE("presence_bitmap_serializer preserves the value and stores the presence in a leading bitmap",
+		  "[serialization][presence_bitmap]") {
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<sparse_update>);
+	for(const auto& update : make_sparse_updates()) {
+		structocol::vector_buffer vb;
+		structocol::serialize(vb, update);
+		CHECK(vb.available_bytes() == structocol::serialized_size(update));
+		CHECK(structocol::deserialize<sparse_update>(vb) == update);
+		CHECK(vb.available_bytes() == 0);
+	}
+
+	sparse_update update{0x01020304, 5, {}, {}, "x", {}, {}, {}, {}, 6, true};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, update);
+	// Presence bits of the 9 optional fields, followed by id, price, source, extra and urgent.
+	std::vector<std::uint8_t> expected{0b1000'0001, 0b1000'0000, 1, 2, 3, 4, 0, 0, 0, 5, 1, 'x', 0, 0, 0, 6, 1};
+	auto data = vb.available_data();
+	REQUIRE(data.size() == expected.size());
+	for(std::size_t i = 0; i < expected.size(); ++i) {
+		CHECK(std::to_integer<std::uint8_t>(data[i]) == expected[i]);
+	}
+	plain_update plain{update.id, update.price, {}, {}, update.source, {}, {}, {}, {}, update.extra, update.urgent};
+	CHECK(structocol::serialized_size(plain) == expected.size() + 7);
+}
+
+TEST_CASE("presence_bitmap_serializer supports deserialize_into, skip, validate and scanning",
+		  "[serialization][presence_bitmap]") {
+	auto updates = make_sparse_updates();
+	structocol::vector_buffer vb;
+	for(const auto& update : updates) {
+		structocol::serialize(vb, update);
+	}
+	for(const auto& update : updates) {
+		CHECK(structocol::scan_serialized_size<sparse_update>(vb.available_data()) ==
+			  structocol::serialized_size(update));
+		structocol::skip<sparse_update>(vb);
+	}
+	CHECK(vb.available_bytes() == 0);
+
+	structocol::serialize(vb, updates.back());
+	auto data = vb.available_data();
+	structocol::serialized_size_scanner<sparse_update> scanner;
+	for(std::size_t i = 0; i < data.size(); ++i) {
+		CHECK(!scanner.resume(data.first(i)).has_value());
+	}
+	CHECK(scanner.resume(data) == data.size());
+	structocol::skip<sparse_update>(vb);
+
+	for(const auto& update : updates) {
+		structocol::serialize(vb, update);
+	}
+	sparse_update reused = updates.back();
+	for(const auto& update : updates) {
+		structocol::validate<sparse_update>(vb);
+		structocol::serialize(vb, update);
+	}
+	for(const auto& update : updates) {
+		structocol::deserialize_into(vb, reused);
+		CHECK(reused == update);
+	}
+	CHECK(vb.available_bytes() == 0);
+}
+
+TEST_CASE("presence_bitmap_serializer reports truncated data", "[serialization][presence_bitmap]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, make_sparse_updates().back());
+	structocol::vector_buffer truncated;
+	truncated.write(vb.available_data().first(vb.available_bytes() - 1));
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<sparse_update>(truncated, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+}
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <structocol/serialization.hpp>
 #include <structocol/vector_buffer.hpp>
 #include <tuple>
@@ -286,6 +287,15 @@ TEST_CASE("serialization size of varint_t applies correctly an calculates the co
 	REQUIRE(s == vb.available_bytes());
 }
 
+TEST_CASE("serialization size of signed_varint_t calculates the correct value", "[serialization_size]") {
+	auto inval = GENERATE(as<structocol::signed_varint_t>{}, 0, 1, -1, 63, -64, 64, -65, 0x7FFF'FFFF, -0x8000'0000ll,
+						  std::numeric_limits<std::ptrdiff_t>::max(), std::numeric_limits<std::ptrdiff_t>::min());
+	structocol::vector_buffer vb;
+	auto s = structocol::serialized_size(inval);
+	structocol::serialize(vb, inval);
+	REQUIRE(s == vb.available_bytes());
+}
+
 namespace {
 enum class test_enum { a, b, c, d };
 } // namespace
@@ -311,6 +321,68 @@ TEMPLATE_TEST_CASE("serialization size of std::bitset is calculated correctly",
 	CHECK(vb.available_bytes() == s);
 }
 
+TEST_CASE("serialization size of bit-packed std::vector<bool> is calculated correctly", "[serialization_size]") {
+	auto count = GENERATE(as<std::size_t>{}, 0, 1, 8, 9, 127, 128, 100000);
+	std::vector<bool> inval(count, true);
+	auto s = structocol::serialized_size(inval);
+	CHECK(s == structocol::serialized_size(structocol::varint_t{count}) + (count + 7) / 8);
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, inval);
+	CHECK(vb.available_bytes() == s);
+}
+
+TEST_CASE("maximum serialization size of bounded types is calculated correctly", "[serialization_size]") {
+	constexpr auto varint_max = structocol::max_serialized_size<structocol::varint_t>();
+	STATIC_REQUIRE(varint_max == (sizeof(std::size_t) * 8 + 6) / 7);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::uint32_t>() == 4);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::optional<std::uint16_t>>() == 3);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::variant<std::monostate, std::uint8_t, double>>() == 9);
+	STATIC_REQUIRE(structocol::max_serialized_size<structocol::magic_number<'a', 'b'>>() == 2);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::array<std::optional<std::uint8_t>, 3>>() == 6);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::pair<structocol::signed_varint_t, std::uint8_t>>() ==
+				   varint_max + 1);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::tuple<std::optional<test_a>, std::bitset<12>>>() ==
+				   1 + structocol::serialized_size<test_a>() + 2);
+	STATIC_REQUIRE(structocol::has_bounded_serialized_size_v<std::uint8_t>);
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::string>);
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::vector<std::uint8_t>>);
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::optional<std::string>>);
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::variant<std::uint8_t, std::string>>);
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::tuple<std::uint8_t, std::vector<bool>>>);
+
+	std::variant<std::monostate, std::uint8_t, double> val = 1.5;
+	CHECK(structocol::serialized_size(val) <= structocol::max_serialized_size<decltype(val)>());
+}
+
+TEST_CASE("maximum serialization size accounts for the integer encoding of the format", "[serialization_size]") {
+	using structocol::varint_format;
+	STATIC_REQUIRE(structocol::max_serialized_size<std::uint32_t, structocol::little_endian_format>() == 4);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::uint64_t, varint_format>() == 10);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::int32_t, varint_format>() == 5);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::uint16_t, varint_format>() == 3);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::uint8_t, varint_format>() == 1);
+	STATIC_REQUIRE(structocol::max_serialized_size<double, varint_format>() == 8);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::optional<std::uint16_t>, varint_format>() == 4);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::pair<std::uint64_t, std::bitset<12>>, varint_format>() ==
+				   10 + 2);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::array<std::uint32_t, 3>, varint_format>() == 15);
+	STATIC_REQUIRE(structocol::max_serialized_size<test_a, varint_format>() >= structocol::serialized_size<test_a>());
+	STATIC_REQUIRE(!structocol::has_bounded_serialized_size_v<std::string, varint_format>);
+	STATIC_REQUIRE(structocol::max_serialized_size<structocol::magic_number<'a', 'b'>, varint_format>() == 2);
+	STATIC_REQUIRE(structocol::max_serialized_size<structocol::magic_number<std::uint16_t{1}>, varint_format>() == 3);
+	STATIC_REQUIRE(
+			structocol::max_serialized_size<structocol::format_version_magic_number_for_t<varint_format>,
+											varint_format>() == 4 * 5);
+	STATIC_REQUIRE(structocol::max_serialized_size<std::monostate, varint_format>() == 0);
+	STATIC_REQUIRE(
+			structocol::max_serialized_size<std::variant<std::monostate, std::uint8_t, double>, varint_format>() == 9);
+
+	std::tuple<std::uint64_t, std::int32_t> val{std::numeric_limits<std::uint64_t>::max(),
+												std::numeric_limits<std::int32_t>::min()};
+	CHECK(structocol::serialized_size<varint_format>(val) ==
+		  structocol::max_serialized_size<decltype(val), varint_format>());
+}
+
 TEST_CASE("serialization size of magic_number is calculated correctly", "[serialization]") {
 	SECTION("for a char sequence") {
 		structocol::magic_number<'H', 'e', 'l', 'l', 'o'> inval;
@@ -345,3 +417,98 @@ TEST_CASE("serialization size of magic_number is calculated correctly", "[serial
 		CHECK(vb.available_bytes() == s);
 	}
 }
+
+namespace {
+struct test_c {
+	std::vector<test_a> vals;
+	std::string text;
+};
+} // namespace
+
+TEST_CASE("types with a fixed serialization size are detected as such", "[serialization_size]") {
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::uint8_t>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::int64_t>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<double>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<const std::uint16_t>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<test_enum>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<test_a>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<test_b>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::array<test_b, 4>>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::tuple<std::int8_t, test_a, std::bitset<12>>>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::pair<const std::uint32_t, float>>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<std::monostate>);
+	STATIC_REQUIRE(structocol::has_fixed_serialized_size_v<structocol::magic_number<'A', 'B'>>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<structocol::varint_t>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<structocol::signed_varint_t>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<std::string>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<std::optional<std::uint8_t>>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<std::variant<std::uint8_t, std::uint16_t>>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<std::tuple<std::int8_t, std::string>>);
+	STATIC_REQUIRE(!structocol::has_fixed_serialized_size_v<test_c>);
+}
+
+TEST_CASE("serialization size of containers of fixed-size aggregates is calculated correctly", "[serialization_size]") {
+	test_c inval{{init_aggregate<test_a>(), init_aggregate<test_a>(), init_aggregate<test_a>()}, "Hello World!"};
+	auto s = structocol::serialized_size(inval);
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, inval);
+	REQUIRE(s == vb.available_bytes());
+}
+
+TEST_CASE("serialize_reserved allocates the exact capacity in advance", "[serialization_size]") {
+	test_c inval{std::vector<test_a>(1000, init_aggregate<test_a>()), std::string(5000, 'x')};
+	auto s = structocol::serialized_size(inval);
+	SECTION("with size pass") {
+		structocol::vector_buffer vb;
+		structocol::serialize_reserved(vb, inval);
+		CHECK(vb.available_bytes() == s);
+		CHECK(vb.total_capacity() == s);
+	}
+	SECTION("with known size") {
+		structocol::vector_buffer vb;
+		structocol::serialize_reserved(vb, inval, s);
+		CHECK(vb.available_bytes() == s);
+		CHECK(vb.total_capacity() == s);
+	}
+	SECTION("repeatedly into the same buffer") {
+		structocol::vector_buffer<structocol::vector_buffer_policies::manual_trim_only> vb;
+		std::size_t reallocations = 0;
+		for(int i = 0; i < 100; ++i) {
+			auto old_capacity = vb.total_capacity();
+			structocol::serialize_reserved(vb, inval);
+			if(vb.total_capacity() != old_capacity) ++reallocations;
+		}
+		CHECK(vb.available_bytes() == 100 * s);
+		// Growth must stay geometric instead of reallocating for every message:
+		CHECK(reallocations <= 8);
+	}
+}
+
+TEST_CASE("serialization size of arrays, tuples and pairs is calculated correctly", "[serialization_size]") {
+	structocol::vector_buffer vb;
+	SECTION("array of fixed-size elements") {
+		std::array<std::uint32_t, 5> inval{1, 2, 3, 4, 5};
+		STATIC_REQUIRE(structocol::serialized_size<std::array<std::uint32_t, 5>>() == 20);
+		auto s = structocol::serialized_size(inval);
+		structocol::serialize(vb, inval);
+		REQUIRE(s == vb.available_bytes());
+	}
+	SECTION("array of variable-size elements") {
+		std::array<std::string, 3> inval{"a", "bc", "def"};
+		auto s = structocol::serialized_size(inval);
+		structocol::serialize(vb, inval);
+		REQUIRE(s == vb.available_bytes());
+	}
+	SECTION("tuple of variable-size elements") {
+		std::tuple<std::string, std::uint16_t, std::vector<std::int8_t>> inval{"Hello", 42, {1, 2, 3}};
+		auto s = structocol::serialized_size(inval);
+		structocol::serialize(vb, inval);
+		REQUIRE(s == vb.available_bytes());
+	}
+	SECTION("pair of variable-size elements") {
+		std::pair<std::string, std::uint64_t> inval{"Hello", 42};
+		auto s = structocol::serialized_size(inval);
+		structocol::serialize(vb, inval);
+		REQUIRE(s == vb.available_bytes());
+	}
+}
@@ -0,0 +1,89 @@
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/span_buffer.hpp>
+#include <variant>
+#include <vector>
+
+namespace {
+struct span_test_msg {
+	std::uint32_t id;
+	std::string name;
+	std::vector<std::int16_t> values;
+};
+bool operator==(const span_test_msg& a, const span_test_msg& b) {
+	return a.id == b.id && a.name == b.name && a.values == b.values;
+}
+struct span_test_view_msg {
+	std::uint32_t id;
+	std::string_view name;
+};
+} // namespace
+
+TEST_CASE("span buffers can read back data written to them", "[span_buffer]") {
+	std::array<std::byte, 64> storage{};
+	structocol::span_write_buffer wb(storage);
+	CHECK(wb.capacity() == 64);
+	span_test_msg msg{42, "Hello", {-1, 2, -3}};
+	structocol::serialize(wb, msg);
+	CHECK(wb.available_bytes() == structocol::serialized_size(msg));
+	CHECK(wb.free_bytes() == 64 - wb.available_bytes());
+	CHECK(wb.available_data().data() == storage.data());
+
+	structocol::span_read_buffer rb(wb.available_data());
+	CHECK(structocol::deserialize<span_test_msg>(rb) == msg);
+	CHECK(rb.available_bytes() == 0);
+	CHECK(!rb.try_read<1>().has_value());
+	CHECK_THROWS_AS(rb.read<1>(), structocol::buffer_length_error);
+
+	wb.clear();
+	CHECK(wb.available_bytes() == 0);
+	CHECK(wb.free_bytes() == 64);
+}
+
+TEST_CASE("span_read_buffer borrows views from the underlying memory", "[span_buffer]") {
+	std::vector<std::byte> received;
+	{
+		std::array<std::byte, 32> storage{};
+		structocol::span_write_buffer wb(storage);
+		structocol::serialize(wb, span_test_msg{7, "borrowed", {}});
+		auto data = wb.available_data();
+		received.assign(data.begin(), data.end());
+	}
+	structocol::span_read_buffer rb(received);
+	auto msg = structocol::deserialize<span_test_view_msg>(rb);
+	CHECK(msg.id == 7);
+	CHECK(msg.name == "borrowed");
+	CHECK(reinterpret_cast<const std::byte*>(msg.name.data()) == received.data() + 5);
+	structocol::span_read_buffer skipper(received);
+	skipper.skip(4);
+	CHECK(skipper.available_bytes() == received.size() - 4);
+	CHECK(!skipper.try_skip(received.size()));
+}
+
+TEST_CASE("span_write_buffer reports overflowing writes", "[span_buffer]") {
+	std::array<std::byte, 8> storage{};
+	structocol::span_write_buffer wb(storage);
+	structocol::serialize(wb, std::uint32_t(1));
+	CHECK_THROWS_AS(structocol::serialize(wb, std::uint64_t(2)), structocol::buffer_length_error);
+	CHECK(wb.available_bytes() == 4);
+	structocol::serialize(wb, std::uint32_t(3));
+	CHECK(wb.free_bytes() == 0);
+	CHECK_THROWS_AS(wb.write(std::array{std::byte{1}}), structocol::buffer_length_error);
+}
+
+TEST_CASE("protocol_handler works on span buffers", "[span_buffer]") {
+	using handler = structocol::protocol_handler<span_test_msg, std::uint64_t>;
+	std::array<std::byte, 128> storage{};
+	structocol::span_write_buffer wb(storage);
+	handler::encode_message(wb, span_test_msg{1, "first", {1, 2}});
+	handler::encode_message(wb, std::uint64_t(0xABCDEF));
+	structocol::span_read_buffer rb(wb.available_data());
+	CHECK(std::get<span_test_msg>(handler::decode_message(rb)) == span_test_msg{1, "first", {1, 2}});
+	CHECK(std::get<std::uint64_t>(handler::decode_message(rb)) == 0xABCDEF);
+	CHECK(rb.available_bytes() == 0);
+}
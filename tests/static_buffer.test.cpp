@@ -0,0 +1,98 @@
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <structocol/exceptions.hpp>
+#include <structocol/protocol_handler.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/static_buffer.hpp>
+#include <variant>
+
+namespace {
+struct ping_msg {
+	std::uint32_t sequence;
+	std::optional<std::uint64_t> timestamp;
+};
+struct ack_msg {
+	structocol::varint_t sequence;
+	std::variant<std::monostate, std::uint8_t, std::array<std::uint16_t, 4>> detail;
+};
+using control_protocol = structocol::protocol_handler<ping_msg, ack_msg>;
+enum class priority : std::uint16_t { low, high = 0xFFFF };
+struct counter_msg {
+	std::uint64_t value;
+	std::uint32_t source;
+	std::int16_t delta;
+	priority prio;
+};
+} // namespace
+
+TEST_CASE("static_buffer can read back data written to it", "[static_buffer]") {
+	structocol::static_buffer<8> sb;
+	sb.write(std::array{std::byte('H'), std::byte('e'), std::byte('l')});
+	sb.write(std::array{std::byte('l'), std::byte('o')});
+	CHECK(sb.available_bytes() == 5);
+	CHECK(sb.free_bytes() == 3);
+	CHECK(sb.read<1>().front() == std::byte('H'));
+	auto rest = sb.read<4>();
+	CHECK(rest[0] == std::byte('e'));
+	CHECK(rest[3] == std::byte('o'));
+	CHECK(sb.available_bytes() == 0);
+	CHECK_THROWS_AS(sb.read<1>(), structocol::buffer_length_error);
+	CHECK(!sb.try_read<1>().has_value());
+}
+
+TEST_CASE("static_buffer moves unread data to the front when a write doesn't fit behind them", "[static_buffer]") {
+	structocol::static_buffer<4> sb;
+	sb.write(std::array{std::byte(1), std::byte(2), std::byte(3)});
+	CHECK(sb.read<2>()[1] == std::byte(2));
+	sb.write(std::array{std::byte(4), std::byte(5), std::byte(6)});
+	CHECK(sb.available_bytes() == 4);
+	CHECK(sb.available_data()[0] == std::byte(3));
+	CHECK(sb.available_data()[3] == std::byte(6));
+	CHECK_THROWS_AS(sb.write(std::array{std::byte(7)}), structocol::buffer_length_error);
+	sb.skip(4);
+	CHECK(!sb.try_skip(1));
+	sb.clear();
+	CHECK(sb.free_bytes() == 4);
+}
+
+TEST_CASE("messages can be encoded into a static_buffer_for their maximum serialized size", "[static_buffer]") {
+	STATIC_REQUIRE(structocol::max_serialized_size<ping_msg>() == 4 + 1 + 8);
+	STATIC_REQUIRE(structocol::max_serialized_size<ack_msg>() == sizeof(std::size_t) * 8 / 7 + 1 + 1 + 8);
+	structocol::static_buffer_for<std::variant<ping_msg, ack_msg>> sb;
+	ack_msg ack{std::numeric_limits<std::size_t>::max(), std::array<std::uint16_t, 4>{1, 2, 3, 4}};
+	control_protocol::encode_message(sb, ack);
+	CHECK(sb.free_bytes() == 0);
+	auto decoded = std::get<ack_msg>(control_protocol::decode_message(sb));
+	CHECK(decoded.sequence.value == ack.sequence.value);
+	CHECK(decoded.detail == ack.detail);
+
+	control_protocol::encode_message(sb, ping_msg{7, 1234});
+	auto ping = std::get<ping_msg>(control_protocol::decode_message(sb));
+	CHECK(ping.sequence == 7);
+	CHECK(ping.timestamp == 1234u);
+}
+
+TEST_CASE("static_buffer_for a varint_format message holds its maximum-length encoding", "[static_buffer]") {
+	STATIC_REQUIRE(structocol::max_serialized_size<counter_msg>() == 8 + 4 + 2 + 2);
+	STATIC_REQUIRE(structocol::max_serialized_size<counter_msg, structocol::varint_format>() == 10 + 5 + 3 + 3);
+	using varint_protocol = structocol::basic_protocol_handler<structocol::varint_format, counter_msg, ping_msg>;
+	structocol::static_buffer_for<std::variant<counter_msg, ping_msg>, structocol::varint_format> sb;
+	counter_msg msg{std::numeric_limits<std::uint64_t>::max(), std::numeric_limits<std::uint32_t>::max(),
+					std::numeric_limits<std::int16_t>::min(), priority::high};
+	varint_protocol::encode_message(sb, msg);
+	CHECK(sb.available_bytes() == 1 + 10 + 5 + 3 + 3);
+	auto decoded = std::get<counter_msg>(varint_protocol::decode_message(sb));
+	CHECK(decoded.value == msg.value);
+	CHECK(decoded.source == msg.source);
+	CHECK(decoded.delta == msg.delta);
+	CHECK(decoded.prio == msg.prio);
+
+	structocol::static_buffer_for<counter_msg, structocol::varint_format> direct;
+	structocol::serialize<structocol::varint_format>(direct, msg);
+	CHECK(direct.free_bytes() == 0);
+}
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <catch2/catch_all.hpp>
 #include <memory>
+#include <vector>
 #include <structocol/stdio_buffer.hpp>
 
 namespace {
@@ -90,6 +91,22 @@ TEST_CASE("stdio_buffer can read back data written to it (reads after writes)",
 	}
 }
 
+TEST_CASE("stdio_buffer can read back data written to it using spans", "[stdio_buffer]") {
+	std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "w+b"),
+																	[](std::FILE* f) { std::fclose(f); }};
+	structocol::stdio_buffer iob(file_handle.get());
+	std::vector<std::byte> data(5000);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte(b += 3); });
+	checked_rewinder cr(file_handle.get(), 5000);
+	iob.write(std::span<const std::byte>(data));
+	cr.rewind();
+	std::vector<std::byte> read_back(5000);
+	iob.read_into(read_back);
+	CHECK(read_back == data);
+	cr.check();
+	CHECK_THROWS_AS(iob.read_into(read_back), std::runtime_error);
+}
+
 TEST_CASE("stdio_buffer can read back data written to it (interleaved)", "[stdio_buffer]") {
 	std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "w+b"),
 																	[](std::FILE* f) { std::fclose(f); }};
@@ -170,3 +187,70 @@ TEST_CASE("Errors from stdio are correctly signalled in stdio_buffer.", "[stdio_
 		CHECK_THROWS_AS(iob.write(std::array{std::byte{42}}), std::runtime_error);
 	}
 }
+
+TEST_CASE("buffered stdio buffers can read back data written to them", "[stdio_buffer]") {
+	std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "w+b"),
+																	[](std::FILE* f) { std::fclose(f); }};
+	std::vector<std::byte> data(5000);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte(b += 3); });
+	{
+		structocol::buffered_stdio_output_buffer ob(file_handle.get(), 16);
+		for(std::size_t i = 0; i < 100; ++i) {
+			ob.write(std::array{data[i]});
+		}
+		CHECK(ob.buffered_bytes() == 4);
+		ob.write(std::span<const std::byte>(data).subspan(100));
+		CHECK(ob.buffered_bytes() == 0);
+		ob.flush();
+		CHECK(std::ftell(file_handle.get()) == 5000);
+	}
+	std::rewind(file_handle.get());
+	structocol::buffered_stdio_input_buffer ib(file_handle.get(), 16);
+	for(std::size_t i = 0; i < 100; ++i) {
+		REQUIRE(ib.read<1>().front() == data[i]);
+	}
+	ib.skip(1000);
+	std::vector<std::byte> read_back(3900);
+	ib.read_into(read_back);
+	CHECK(std::equal(read_back.begin(), read_back.end(), data.begin() + 1100));
+	CHECK(!ib.try_read<1>().has_value());
+	CHECK_THROWS_AS(ib.read<1>(), std::runtime_error);
+}
+
+TEST_CASE("buffered_stdio_output_buffer writes the remaining data on destruction", "[stdio_buffer]") {
+	std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "w+b"),
+																	[](std::FILE* f) { std::fclose(f); }};
+	{
+		structocol::buffered_stdio_output_buffer ob(file_handle.get());
+		ob.write(std::array{std::byte('T'), std::byte('e'), std::byte('s'), std::byte('t')});
+		CHECK(ob.buffered_bytes() == 4);
+		CHECK(std::ftell(file_handle.get()) == 0);
+	}
+	CHECK(std::ftell(file_handle.get()) == 4);
+	std::rewind(file_handle.get());
+	structocol::buffered_stdio_input_buffer ib(file_handle.get());
+	auto data = ib.read<4>();
+	CHECK(data == std::array{std::byte('T'), std::byte('e'), std::byte('s'), std::byte('t')});
+	CHECK(!ib.try_skip(1));
+}
+
+TEST_CASE("Errors from stdio are correctly signalled in buffered stdio buffers.", "[stdio_buffer]") {
+	SECTION("attempting to read() from a write-only opened file") {
+		std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "wb"),
+																		[](std::FILE* f) { std::fclose(f); }};
+		structocol::buffered_stdio_input_buffer ib(file_handle.get());
+		CHECK_THROWS_AS(ib.read<1>(), std::runtime_error);
+	}
+	SECTION("attempting to flush() to a read-only opened file") {
+		{
+			// Touch and truncate file:
+			std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "wb"),
+																			[](std::FILE* f) { std::fclose(f); }};
+		}
+		std::unique_ptr<std::FILE, void (*)(std::FILE*)> file_handle = {std::fopen("test_file.temp", "rb"),
+																		[](std::FILE* f) { std::fclose(f); }};
+		structocol::buffered_stdio_output_buffer ob(file_handle.get());
+		ob.write(std::array{std::byte{42}});
+		CHECK_THROWS_AS(ob.flush(), std::runtime_error);
+	}
+}
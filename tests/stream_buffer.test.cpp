@@ -0,0 +1,65 @@
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <structocol/serialization.hpp>
+#include <structocol/stream_buffer.hpp>
+#include <vector>
+
+TEST_CASE("buffered stream buffers can read back data written to them", "[stream_buffer]") {
+	std::stringstream stream;
+	std::vector<std::byte> data(5000);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte(b += 3); });
+	{
+		structocol::buffered_ostream_buffer ob(stream, 16);
+		for(std::size_t i = 0; i < 100; ++i) {
+			ob.write(std::array{data[i]});
+		}
+		CHECK(ob.buffered_bytes() == 4);
+		ob.write(std::span<const std::byte>(data).subspan(100));
+		CHECK(ob.buffered_bytes() == 0);
+		ob.flush();
+	}
+	CHECK(stream.str().size() == 5000);
+	structocol::buffered_istream_buffer ib(stream, 16);
+	for(std::size_t i = 0; i < 100; ++i) {
+		REQUIRE(ib.read<1>().front() == data[i]);
+	}
+	ib.skip(1000);
+	std::vector<std::byte> read_back(3900);
+	ib.read_into(read_back);
+	CHECK(std::equal(read_back.begin(), read_back.end(), data.begin() + 1100));
+	CHECK(!ib.try_read<1>().has_value());
+	CHECK(stream.eof());
+	CHECK_THROWS_AS(ib.read<1>(), std::runtime_error);
+}
+
+TEST_CASE("buffered_ostream_buffer writes the remaining data on destruction", "[stream_buffer]") {
+	std::ostringstream stream;
+	{
+		structocol::buffered_ostream_buffer ob(stream);
+		structocol::serialize(ob, std::string("Hello World"));
+		CHECK(stream.str().empty());
+	}
+	CHECK(stream.str().size() == 12);
+	std::istringstream in(stream.str());
+	structocol::buffered_istream_buffer ib(in);
+	CHECK(structocol::deserialize<std::string>(ib) == "Hello World");
+	CHECK(!ib.try_skip(1));
+}
+
+TEST_CASE("Reading from a buffered_istream_buffer past the end fails as expected", "[stream_buffer]") {
+	std::istringstream stream("abc");
+	structocol::buffered_istream_buffer ib(stream, 2);
+	SECTION("using read()") {
+		CHECK_THROWS_AS(ib.read<4>(), std::runtime_error);
+	}
+	SECTION("using try_read()") {
+		CHECK(!ib.try_read<4>().has_value());
+	}
+	SECTION("using skip()") {
+		ib.skip(3);
+		CHECK_THROWS_AS(ib.skip(1), std::runtime_error);
+	}
+}
@@ -0,0 +1,161 @@
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <structocol/error_code.hpp>
+#include <structocol/exceptions.hpp>
+#include <structocol/incremental_decoder.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/varint_sequence.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+namespace {
+// Buffer that only supports the required members, to test the paths for buffers without read_view().
+struct minimal_buffer {
+	structocol::vector_buffer<> inner;
+	template <std::size_t bytes>
+	std::array<std::byte, bytes> read() {
+		return inner.read<bytes>();
+	}
+	template <std::size_t bytes>
+	std::optional<std::array<std::byte, bytes>> try_read() {
+		return inner.try_read<bytes>();
+	}
+	template <std::size_t bytes>
+	void write(const std::array<std::byte, bytes>& data) {
+		inner.write(data);
+	}
+};
+
+template <typename T>
+structocol::varint_sequence<T> make_mixed_sequence(std::size_t count) {
+	structocol::varint_sequence<T> res;
+	for(std::size_t i = 0; i < count; ++i) {
+		// Cycle through all encoded lengths.
+		auto bits = (i * 7) % std::numeric_limits<T>::digits;
+		auto value = T((T(1) << bits) + i);
+		if constexpr(std::is_signed_v<T>) {
+			if(i % 2) value = T(-value);
+		}
+		res.push_back(value);
+	}
+	return res;
+}
+
+struct sequence_msg {
+	std::uint8_t kind;
+	structocol::varint_sequence<std::uint32_t> ids;
+	std::string name;
+};
+} // namespace
+
+TEMPLATE_TEST_CASE("varint_sequence arrives as it was sent", "[serialization][varint_sequence]", std::uint16_t,
+				   std::uint32_t, std::uint64_t, std::int16_t, std::int32_t, std::int64_t) {
+	auto count = GENERATE(as<std::size_t>{}, 0, 1, 3, 4, 5, 17, 1000);
+	auto seq = make_mixed_sequence<TestType>(count);
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, seq);
+	CHECK(vb.available_bytes() == structocol::serialized_size(seq));
+	CHECK(structocol::deserialize<structocol::varint_sequence<TestType>>(vb) == seq);
+	CHECK(vb.available_bytes() == 0);
+
+	minimal_buffer mb;
+	structocol::serialize(mb, seq);
+	CHECK(structocol::deserialize<structocol::varint_sequence<TestType>>(mb) == seq);
+	CHECK(mb.inner.available_bytes() == 0);
+}
+
+TEST_CASE("varint_sequence encodes each element with its minimal length", "[serialization][varint_sequence]") {
+	structocol::varint_sequence<std::uint32_t> seq{0, 0x12, 0x1234, 0x123456, 0x12345678};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, seq);
+	// Length codes of the elements: 0, 0, 1, 2 in the first control byte and 3 in the second.
+	std::vector<std::uint8_t> expected{5,	 0b10'01'00'00, 0b11, 0x00, 0x12, 0x12, 0x34, 0x12, 0x34,
+									   0x56, 0x12,			0x34, 0x56, 0x78};
+	auto data = vb.available_data();
+	REQUIRE(data.size() == expected.size());
+	for(std::size_t i = 0; i < expected.size(); ++i) {
+		CHECK(std::to_integer<std::uint8_t>(data[i]) == expected[i]);
+	}
+}
+
+TEST_CASE("varint_sequence stores signed elements as their ZigZag mapping", "[serialization][varint_sequence]") {
+	structocol::varint_sequence<std::int32_t> seq{0, -1, 1, -64, 64, -0x800000, std::numeric_limits<std::int32_t>::min()};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, seq);
+	// Count, 2 control bytes and data lengths 1, 1, 1, 1, 1, 3, 4
+	CHECK(vb.available_bytes() == 1 + 2 + 12);
+	CHECK(structocol::deserialize<structocol::varint_sequence<std::int32_t>>(vb) == seq);
+}
+
+TEMPLATE_TEST_CASE("varint_sequence decodes all length combinations of 32 bit elements",
+				   "[serialization][varint_sequence]", std::uint32_t, std::int32_t) {
+#if(defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+	// The SSSE3 decoder is compiled in regardless of the compiler flags and only depends on the CPU.
+	CHECK(structocol::detail::varint_sequence_ssse3_decoding() == (__builtin_cpu_supports("ssse3") != 0));
+#endif
+	// Every control byte value, i.e. every combination of lengths in a group of 4 elements, occurs once.
+	structocol::varint_sequence<TestType> seq;
+	for(unsigned control = 0; control < 256; ++control) {
+		for(unsigned elem = 0; elem < 4; ++elem) {
+			unsigned length = ((control >> (elem * 2)) & 0b11) + 1;
+			auto wire_value = std::uint32_t((std::uint64_t(1) << (length * 8 - 1)) | (control & 0x7F));
+			if constexpr(std::is_signed_v<TestType>) {
+				seq.push_back(structocol::detail::zigzag_decode(wire_value));
+			} else {
+				seq.push_back(wire_value);
+			}
+		}
+	}
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, seq);
+	CHECK(vb.available_bytes() == structocol::serialized_size(seq));
+	CHECK(structocol::deserialize<structocol::varint_sequence<TestType>>(vb) == seq);
+}
+
+TEST_CASE("varint_sequence can be part of messages and supports skip, validate and scanning",
+		  "[serialization][varint_sequence]") {
+	sequence_msg msg{3, make_mixed_sequence<std::uint32_t>(101), "after"};
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, msg);
+	structocol::serialize(vb, msg);
+	structocol::serialize(vb, msg);
+	auto size = structocol::serialized_size(msg);
+	CHECK(structocol::scan_serialized_size<sequence_msg>(vb.available_data()) == size);
+	CHECK(!structocol::scan_serialized_size<sequence_msg>(vb.available_data().first(size - 1)).has_value());
+	structocol::skip<sequence_msg>(vb);
+	structocol::validate<sequence_msg>(vb);
+	auto res = structocol::deserialize<sequence_msg>(vb);
+	CHECK(res.kind == msg.kind);
+	CHECK(res.ids == msg.ids);
+	CHECK(res.name == msg.name);
+}
+
+TEST_CASE("varint_sequence reports truncated and invalid data", "[serialization][varint_sequence]") {
+	auto seq = make_mixed_sequence<std::uint64_t>(10);
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, seq);
+	structocol::vector_buffer truncated;
+	truncated.write(vb.available_data().first(vb.available_bytes() - 1));
+	std::error_code ec;
+	CHECK(!structocol::try_deserialize<structocol::varint_sequence<std::uint64_t>>(truncated, ec).has_value());
+	CHECK(ec == structocol::errc::insufficient_data);
+
+	structocol::vector_buffer invalid;
+	structocol::serialize(invalid, structocol::varint_t{1});
+	structocol::serialize(invalid, std::uint8_t{8});
+	structocol::serialize(invalid, std::uint64_t{0});
+	structocol::serialize(invalid, std::uint8_t{0});
+	auto invalid_data = invalid.available_data();
+	CHECK_THROWS_AS(structocol::scan_serialized_size<structocol::varint_sequence<std::uint64_t>>(invalid_data),
+					structocol::deserialization_data_error);
+	CHECK(!structocol::try_validate<structocol::varint_sequence<std::uint64_t>>(invalid, ec));
+	CHECK(ec == structocol::errc::invalid_data);
+}
@@ -107,3 +107,21 @@ TEST_CASE("vector_buffer trim reuses already read memory to regain writable capa
 		REQUIRE(vb.writable_capacity() == vb.total_capacity());
 	}
 }
+
+TEST_CASE("vector_buffer supports runtime-sized reads and writes using spans", "[vector_buffer]") {
+	structocol::vector_buffer vb;
+	std::vector<std::byte> data(1000);
+	std::generate(data.begin(), data.end(), [b = std::uint8_t{0}]() mutable { return std::byte{b++}; });
+	vb.write(std::span<const std::byte>(data));
+	REQUIRE(vb.available_bytes() == 1000);
+	std::vector<std::byte> read_back(600);
+	vb.read_into(read_back);
+	CHECK(std::equal(data.begin(), data.begin() + 600, read_back.begin(), read_back.end()));
+	CHECK(vb.available_bytes() == 400);
+	CHECK_THROWS_AS(vb.read_into(read_back), structocol::buffer_length_error);
+	CHECK(vb.available_bytes() == 400);
+	read_back.resize(400);
+	vb.read_into(read_back);
+	CHECK(std::equal(data.begin() + 600, data.end(), read_back.begin(), read_back.end()));
+	CHECK(vb.available_bytes() == 0);
+}
@@ -0,0 +1,147 @@
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <string>
+#include <string_view>
+#include <structocol/exceptions.hpp>
+#include <structocol/serialization.hpp>
+#include <structocol/vector_buffer.hpp>
+#include <structocol/view.hpp>
+#include <vector>
+
+namespace {
+// Number of allocations through the global operator new, to check that view doesn't allocate.
+std::atomic<std::size_t> global_allocations = 0;
+} // namespace
+
+void* operator new(std::size_t size) {
+	++global_allocations;
+	if(void* p = std::malloc(size ? size : 1)) return p;
+	throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept {
+	std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+	std::free(p);
+}
+
+namespace {
+struct route_header {
+	std::uint32_t routing_key;
+	std::uint16_t flags;
+};
+struct routed_msg {
+	route_header header;
+	std::uint64_t sequence;
+	std::string sender;
+	std::vector<std::uint32_t> samples;
+	std::map<std::string, std::string> properties;
+	std::uint32_t destination;
+	std::string_view note;
+};
+routed_msg make_routed_msg() {
+	return routed_msg{{0xCAFE, 7},
+					  123456789,
+					  "sender name",
+					  std::vector<std::uint32_t>(1000, 0xABCDEF),
+					  {{"a", "b"}, {"key", "value"}},
+					  0x12345678,
+					  "a note"};
+}
+} // namespace
+
+TEST_CASE("view decodes individual fields of a serialized aggregate", "[view]") {
+	structocol::vector_buffer vb;
+	auto msg = make_routed_msg();
+	structocol::serialize(vb, msg);
+	structocol::view<routed_msg> v(vb.available_data());
+	CHECK(v.get<0>().routing_key == 0xCAFE);
+	CHECK(v.get_view<0>().get<1>() == 7);
+	CHECK(v.get<1>() == msg.sequence);
+	CHECK(v.get<2>() == msg.sender);
+	CHECK(v.get<3>() == msg.samples);
+	CHECK(v.get<4>() == msg.properties);
+	CHECK(v.get<5>() == msg.destination);
+	CHECK(v.get<6>() == msg.note);
+	CHECK(v.serialized_size() == structocol::serialized_size(msg));
+	CHECK(v.data().size() == vb.available_bytes());
+	CHECK(v.field_data<2>().size() == structocol::serialized_size(msg.sender));
+	auto full = v.deserialize();
+	CHECK(full.samples == msg.samples);
+	CHECK(full.properties == msg.properties);
+}
+
+TEST_CASE("view doesn't look at the data of unrelated fields", "[view]") {
+	structocol::vector_buffer vb;
+	auto msg = make_routed_msg();
+	structocol::serialize(vb, msg);
+	auto data = vb.available_data();
+	SECTION("fields in the fixed-size prefix are accessible without the rest of the data") {
+		structocol::view<routed_msg> v(data.first(14));
+		CHECK(v.get_view<0>().get<0>() == 0xCAFE);
+		CHECK(v.get<1>() == msg.sequence);
+		CHECK_THROWS_AS(v.get<2>(), structocol::buffer_length_error);
+	}
+	SECTION("contents of fixed-size element containers are skipped without reading them") {
+		std::vector<std::byte> modified(data.begin(), data.end());
+		auto samples_offset = 14 + structocol::serialized_size(msg.sender) +
+							  structocol::serialized_size(structocol::varint_t{msg.samples.size()});
+		std::fill_n(modified.begin() + samples_offset, msg.samples.size() * 4, std::byte{0xFF});
+		structocol::view<routed_msg> v(modified);
+		CHECK(v.get<5>() == msg.destination);
+		CHECK(v.get<3>() != msg.samples);
+	}
+}
+
+TEST_CASE("view borrows string_view fields from the viewed data", "[view]") {
+	structocol::vector_buffer vb;
+	structocol::serialize(vb, make_routed_msg());
+	auto data = vb.available_data();
+	structocol::view<routed_msg> v(data);
+	auto note = v.get<6>();
+	CHECK(static_cast<const void*>(note.data()) >= static_cast<const void*>(data.data()));
+	CHECK(static_cast<const void*>(note.data() + note.size()) <=
+		  static_cast<const void*>(data.data() + data.size()));
+}
+
+TEST_CASE("view reports truncated data", "[view]") {
+	structocol::vector_buffer vb;
+	auto msg = make_routed_msg();
+	structocol::serialize(vb, msg);
+	auto data = vb.available_data();
+	structocol::view<routed_msg> v(data.first(data.size() - 10));
+	CHECK(v.get<4>() == msg.properties);
+	CHECK_THROWS_AS(v.get<6>(), structocol::buffer_length_error);
+	CHECK_THROWS_AS(v.serialized_size(), structocol::buffer_length_error);
+	CHECK(v.field_data<4>().size() == structocol::serialized_size(msg.properties));
+	CHECK_THROWS_AS(v.field_data<5>(), structocol::buffer_length_error);
+	CHECK_THROWS_AS(v.data(), structocol::buffer_length_error);
+
+	structocol::view<route_header> header_view(data.first(3));
+	CHECK_THROWS_AS(header_view.field_data<1>(), structocol::buffer_length_error);
+	CHECK_THROWS_AS(header_view.serialized_size(), structocol::buffer_length_error);
+	CHECK_THROWS_AS(header_view.data(), structocol::buffer_length_error);
+}
+
+TEST_CASE("view accesses fields after variable-length fields without allocating", "[view]") {
+	structocol::vector_buffer vb;
+	auto msg = make_routed_msg();
+	structocol::serialize(vb, msg);
+	structocol::view<routed_msg> v(vb.available_data());
+	auto allocations_before = global_allocations;
+	auto destination = v.get<5>();
+	auto note = v.get<6>();
+	auto properties_size = v.field_data<4>().size();
+	auto size = v.serialized_size();
+	auto allocations = global_allocations - allocations_before;
+	CHECK(allocations == 0);
+	CHECK(destination == msg.destination);
+	CHECK(note == msg.note);
+	CHECK(properties_size == structocol::serialized_size(msg.properties));
+	CHECK(size == structocol::serialized_size(msg));
+}